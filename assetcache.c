@@ -0,0 +1,170 @@
+/***************************************************************
+                          assetcache.c
+
+Keeps the assets which all minigames share loaded between them,
+so switching minigames doesn't read them from the ROM again.
+***************************************************************/
+
+#include <libdragon.h>
+#include <string.h>
+#include "assetcache.h"
+
+
+/*********************************
+           Definitions
+*********************************/
+
+#define MAXCACHEDASSETS  16
+
+typedef enum {
+    ASSET_NONE = 0,
+    ASSET_SOUND,
+    ASSET_FONT,
+} AssetType;
+
+typedef struct {
+    AssetType type;
+    const char* path;
+    void* asset;
+    uint32_t outstanding;   // Gets which were not released yet, only used to catch over-releases
+} CachedAsset;
+
+
+/*********************************
+             Globals
+*********************************/
+
+static CachedAsset global_assetcache[MAXCACHEDASSETS];
+
+
+/*==============================
+    assetcache_find
+    Finds the cached asset with the given path
+    @param  The type of asset
+    @param  The path of the asset
+    @return The cached asset, or NULL if it isn't loaded
+==============================*/
+
+static CachedAsset* assetcache_find(AssetType type, const char* path)
+{
+    for (int i=0; i<MAXCACHEDASSETS; i++)
+        if (global_assetcache[i].type == type && !strcmp(global_assetcache[i].path, path))
+            return &global_assetcache[i];
+    return NULL;
+}
+
+
+/*==============================
+    assetcache_find_asset
+    Finds the cached asset with the given data
+    @param  The asset data
+    @return The cached asset
+==============================*/
+
+static CachedAsset* assetcache_find_asset(void* asset)
+{
+    for (int i=0; i<MAXCACHEDASSETS; i++)
+        if (global_assetcache[i].type != ASSET_NONE && global_assetcache[i].asset == asset)
+            return &global_assetcache[i];
+    assertf(false, "Asset %p was not loaded by the asset cache\n", asset);
+    return NULL;
+}
+
+
+/*==============================
+    assetcache_add
+    Adds a newly loaded asset to the cache
+    @param  The type of asset
+    @param  The path of the asset
+    @param  The asset data
+==============================*/
+
+static void assetcache_add(AssetType type, const char* path, void* asset)
+{
+    for (int i=0; i<MAXCACHEDASSETS; i++)
+    {
+        if (global_assetcache[i].type == ASSET_NONE)
+        {
+            global_assetcache[i].type = type;
+            global_assetcache[i].path = strdup(path);
+            global_assetcache[i].asset = asset;
+            global_assetcache[i].outstanding = 1;
+            return;
+        }
+    }
+    assertf(false, "Asset cache is full, cannot add %s\n", path);
+}
+
+
+/*==============================
+    assetcache_get_sound
+    Gets a shared sound, loading it if needed
+    @param  The path of the sound
+    @return The sound
+==============================*/
+
+wav64_t* assetcache_get_sound(const char* path)
+{
+    CachedAsset* cached = assetcache_find(ASSET_SOUND, path);
+    if (cached != NULL)
+    {
+        cached->outstanding++;
+        return (wav64_t*)cached->asset;
+    }
+
+    wav64_t* sound = malloc(sizeof(wav64_t));
+    wav64_open(sound, path);
+    assetcache_add(ASSET_SOUND, path, sound);
+    return sound;
+}
+
+
+/*==============================
+    assetcache_release_sound
+    Releases a shared sound, it stays loaded
+    @param  The sound to release
+==============================*/
+
+void assetcache_release_sound(wav64_t* sound)
+{
+    CachedAsset* cached = assetcache_find_asset(sound);
+    assertf(cached->outstanding > 0, "Sound %s was released too many times\n", cached->path);
+    cached->outstanding--;
+    wav64_set_loop(sound, false);
+}
+
+
+/*==============================
+    assetcache_get_font
+    Gets a shared font, loading it if needed
+    @param  The path of the font
+    @return The font
+==============================*/
+
+rdpq_font_t* assetcache_get_font(const char* path)
+{
+    CachedAsset* cached = assetcache_find(ASSET_FONT, path);
+    if (cached != NULL)
+    {
+        cached->outstanding++;
+        return (rdpq_font_t*)cached->asset;
+    }
+
+    rdpq_font_t* font = rdpq_font_load(path);
+    assetcache_add(ASSET_FONT, path, font);
+    return font;
+}
+
+
+/*==============================
+    assetcache_release_font
+    Releases a shared font, it stays loaded
+    @param  The font to release
+==============================*/
+
+void assetcache_release_font(rdpq_font_t* font)
+{
+    CachedAsset* cached = assetcache_find_asset(font);
+    assertf(cached->outstanding > 0, "Font %s was released too many times\n", cached->path);
+    cached->outstanding--;
+}
@@ -0,0 +1,78 @@
+#ifndef GAMEJAM2024_ASSETCACHE_H
+#define GAMEJAM2024_ASSETCACHE_H
+
+#include <libdragon.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    /***************************************************************
+                      Public Asset Cache Constants
+    ***************************************************************/
+
+    // The sounds every minigame plays
+    #define ASSETCACHE_SFX_START      "rom:/core/Start.wav64"
+    #define ASSETCACHE_SFX_COUNTDOWN  "rom:/core/Countdown.wav64"
+    #define ASSETCACHE_SFX_STOP       "rom:/core/Stop.wav64"
+    #define ASSETCACHE_SFX_WINNER     "rom:/core/Winner.wav64"
+
+    // The font of the menus
+    #define ASSETCACHE_FONT_SQUAREWAVE  "rom:/squarewave.font64"
+
+
+    /***************************************************************
+                      Public Asset Cache Functions
+    ***************************************************************/
+
+    // Cached assets are never freed, they stay loaded for as long as
+    // the game runs. Releasing an asset only checks that it isn't
+    // released more times than it was gotten.
+
+    /*==============================
+        assetcache_get_sound
+        Gets a sound shared between minigames, loading it the
+        first time it is requested. It stays loaded after it
+        is released, so the next minigame doesn't need to
+        read it from the ROM again.
+        Only use this for assets which many minigames share,
+        like the ones in rom:/core/.
+        @param  The path of the sound
+        @return The sound. Do not close it, release it with
+                assetcache_release_sound instead.
+    ==============================*/
+    wav64_t* assetcache_get_sound(const char* path);
+
+    /*==============================
+        assetcache_release_sound
+        Releases a sound from assetcache_get_sound.
+        Looping is turned back off, in case it was changed.
+        @param  The sound to release
+    ==============================*/
+    void assetcache_release_sound(wav64_t* sound);
+
+    /*==============================
+        assetcache_get_font
+        Gets a font shared between minigames, loading it the
+        first time it is requested. The font styles are shared
+        as well, so set the ones you need after getting it.
+        @param  The path of the font
+        @return The font. Do not free it, release it with
+                assetcache_release_font instead.
+    ==============================*/
+    rdpq_font_t* assetcache_get_font(const char* path);
+
+    /*==============================
+        assetcache_release_font
+        Releases a font from assetcache_get_font. Unregister
+        it from rdpq_text first, like you would before freeing
+        it.
+        @param  The font to release
+    ==============================*/
+    void assetcache_release_font(rdpq_font_t* font);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -7,6 +7,7 @@ the game jam.
 
 #include <libdragon.h>
 #include "../../core.h"
+#include "../../assetcache.h"
 #include "../../minigame.h"
 #include "64beats.h"
 
@@ -57,10 +58,10 @@ float countdown_timer;
 bool is_ending;
 float end_timer;
 
-wav64_t sfx_start;
-wav64_t sfx_countdown;
-wav64_t sfx_stop;
-wav64_t sfx_winner;
+wav64_t* sfx_start;
+wav64_t* sfx_countdown;
+wav64_t* sfx_stop;
+wav64_t* sfx_winner;
 
 uint32_t start_tick = 0;
 gamestate gameState;
@@ -77,10 +78,10 @@ void minigame_init()
     rdpq_text_register_font(FONT_TEXT, font);
 
 
-    wav64_open(&sfx_start, "rom:/core/Start.wav64");
-    wav64_open(&sfx_countdown, "rom:/core/Countdown.wav64");
-    wav64_open(&sfx_stop, "rom:/core/Stop.wav64");
-    wav64_open(&sfx_winner, "rom:/core/Winner.wav64");
+    sfx_start = assetcache_get_sound(ASSETCACHE_SFX_START);
+    sfx_countdown = assetcache_get_sound(ASSETCACHE_SFX_COUNTDOWN);
+    sfx_stop = assetcache_get_sound(ASSETCACHE_SFX_STOP);
+    sfx_winner = assetcache_get_sound(ASSETCACHE_SFX_WINNER);
     arrow_up_sprite = sprite_load("rom:/64beats/up.rgba32.sprite");
     arrow_down_sprite = sprite_load("rom:/64beats/down.rgba32.sprite");
     arrow_left_sprite = sprite_load("rom:/64beats/left.rgba32.sprite");
@@ -499,10 +500,10 @@ void drawUIForPlayer(uint8_t playerNum, uint8_t dir)
 
 void minigame_cleanup()
 {
-    wav64_close(&sfx_start);
-    wav64_close(&sfx_countdown);
-    wav64_close(&sfx_stop);
-    wav64_close(&sfx_winner);
+    assetcache_release_sound(sfx_start);
+    assetcache_release_sound(sfx_countdown);
+    assetcache_release_sound(sfx_stop);
+    assetcache_release_sound(sfx_winner);
     xm64player_stop(&music);
     xm64player_close(&music);
 
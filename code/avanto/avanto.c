@@ -1,6 +1,7 @@
 #include <libdragon.h>
 #include "../../minigame.h"
 #include "../../core.h"
+#include "../../assetcache.h"
 #include <t3d/t3d.h>
 #include <t3d/t3dmodel.h>
 #include <t3d/t3dskeleton.h>
@@ -96,10 +97,10 @@ struct subgame subgames[] = {
 struct subgame *current_subgame;
 
 xm64player_t music;
-wav64_t sfx_start;
-wav64_t sfx_countdown;
-wav64_t sfx_stop;
-wav64_t sfx_winner;
+wav64_t* sfx_start;
+wav64_t* sfx_countdown;
+wav64_t* sfx_stop;
+wav64_t* sfx_winner;
 
 static bool filter_player_hair_color(void *user_data, const T3DObject *obj) {
   color_t *color = (color_t *) user_data;
@@ -189,7 +190,7 @@ void minigame_init() {
   const color_t YELLOW = RGBA32(0xff, 0xff, 0x00, 0xff);
   const color_t WHITE = RGBA32(0xff, 0xff, 0xff, 0xff);
   const color_t LIGHT_BLUE = RGBA32(0x00, 0xc9, 0xff, 0xff);
-  normal_font = rdpq_font_load("rom:/squarewave.font64");
+  normal_font = assetcache_get_font(ASSETCACHE_FONT_SQUAREWAVE);
   rdpq_text_register_font(FONT_NORMAL, normal_font);
   timer_font = rdpq_font_load("rom:/avanto/timer.font64");
   rdpq_text_register_font(FONT_TIMER, timer_font);
@@ -240,10 +241,10 @@ void minigame_init() {
 
   xm64player_open(&music, "rom:/avanto/sj-polkka.xm64");
 
-  wav64_open(&sfx_start, "rom:/core/Start.wav64");
-  wav64_open(&sfx_countdown, "rom:/core/Countdown.wav64");
-  wav64_open(&sfx_stop, "rom:/core/Stop.wav64");
-  wav64_open(&sfx_winner, "rom:/core/Winner.wav64");
+  sfx_start = assetcache_get_sound(ASSETCACHE_SFX_START);
+  sfx_countdown = assetcache_get_sound(ASSETCACHE_SFX_COUNTDOWN);
+  sfx_stop = assetcache_get_sound(ASSETCACHE_SFX_STOP);
+  sfx_winner = assetcache_get_sound(ASSETCACHE_SFX_WINNER);
 
   mixer_set_vol(1.f);
   for (int i = xm64player_num_channels(&music); i < 32; i++) {
@@ -396,16 +397,16 @@ void minigame_cleanup() {
   if (current_subgame->cleanup) {
     current_subgame->cleanup();
   }
-  wav64_close(&sfx_start);
-  wav64_close(&sfx_countdown);
-  wav64_close(&sfx_stop);
-  wav64_close(&sfx_winner);
+  assetcache_release_sound(sfx_start);
+  assetcache_release_sound(sfx_countdown);
+  assetcache_release_sound(sfx_stop);
+  assetcache_release_sound(sfx_winner);
 
   xm64player_stop(&music);
   xm64player_close(&music);
 
   rdpq_text_unregister_font(FONT_NORMAL);
-  rdpq_font_free(normal_font);
+  assetcache_release_font(normal_font);
   rdpq_text_unregister_font(FONT_TIMER);
   rdpq_font_free(timer_font);
   rdpq_text_unregister_font(FONT_BANNER);
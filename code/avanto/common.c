@@ -9,11 +9,9 @@
 
 #include "common.h"
 
-extern T3DViewport viewport;
 extern struct character players[];
 extern rspq_block_t *empty_hud_block;
 extern struct particle_source particle_sources[];
-extern struct camera cam;
 
 const char *const PLAYER_TITLES[] = {
   SW_PLAYER1_S "P1",
@@ -22,8 +20,6 @@ const char *const PLAYER_TITLES[] = {
   SW_PLAYER4_S "P4",
 };
 
-static bool script_signals[SCRIPT_NUM_SIGNALS];
-
 float get_ground_height(float z, struct ground *ground) {
   float height = 0;
   for (size_t i = 0; i < ground->num_changes; i++) {
@@ -117,181 +113,6 @@ void entity_free(struct entity *e) {
   rspq_block_free(e->display_block);
 }
 
-void script_reset_signals() {
-  for (size_t i = 0; i < SCRIPT_NUM_SIGNALS; i++) {
-    script_signals[i] = false;
-  }
-}
-
-bool script_update(struct script_state *state, float delta_time) {
-  while (delta_time > EPS) {
-    if (state->action->type == ACTION_END) {
-      return true;
-    }
-    else if (state->action->type == ACTION_WARP_TO) {
-      state->character->pos = state->action->pos;
-    }
-    else if (state->action->type == ACTION_WAIT) {
-      if (state->time + delta_time >= state->action->time) {
-        delta_time -= state->action->time - state->time;
-      }
-      else {
-        state->time += delta_time;
-        break;
-      }
-    }
-    else if (state->action->type == ACTION_SET_VISIBILITY) {
-      state->character->visible = state->action->visibility;
-    }
-    else if (state->action->type == ACTION_START_ANIM
-        || state->action->type == ACTION_DO_WHOLE_ANIM) {
-      struct character *c = state->character;
-      T3DAnim *anim = &c->s.anims[state->action->anim];
-      if (!state->time) {
-        c->current_anim = state->action->anim;
-        t3d_anim_attach(anim, &c->s.skeleton);
-        t3d_anim_set_playing(anim, true);
-      }
-
-      if (state->action->type == ACTION_DO_WHOLE_ANIM) {
-        // Anim not over
-        if (state->time - anim->animRef->duration < EPS) {
-          state->time += delta_time;
-          break;
-        }
-        else {
-          delta_time -= anim->animRef->duration - state->time;
-        }
-      }
-    }
-    else if (state->action->type == ACTION_WALK_TO
-        || state->action->type == ACTION_CLIMB_TO) {
-      struct character *c = state->character;
-      if (!state->time) {
-        size_t anim = state->action->type == ACTION_WALK_TO? WALK : CLIMB;
-        c->current_anim = anim;
-        t3d_anim_attach(&c->s.anims[anim], &c->s.skeleton);
-        t3d_anim_set_playing(&c->s.anims[anim], true);
-        float dz = state->action->pos.v[2] - c->pos.v[2];
-        float dx = state->action->pos.v[0] - c->pos.v[0];
-        c->rotation = -fm_atan2f(dx, dz);
-      }
-
-      T3DVec3 diff;
-      t3d_vec3_diff(&diff,
-          &(T3DVec3) {{state->action->pos.v[0], 0.f, state->action->pos.v[2]}},
-          &(T3DVec3) {{c->pos.v[0], 0.f, c->pos.v[2]}});
-
-      float time_to_end = state->action->type == ACTION_WALK_TO?
-        t3d_vec3_len(&diff) / state->action->walk_speed:
-        c->s.anims[CLIMB].animRef->duration - state->time;
-
-      if (time_to_end - delta_time < EPS) {
-        delta_time -= time_to_end;
-        c->pos.v[0] = state->action->pos.v[0];
-        c->pos.v[2] = state->action->pos.v[2];
-      }
-      else {
-        float ratio = delta_time / time_to_end;
-        c->pos.v[0] += ratio * diff.v[0];
-        c->pos.v[2] += ratio * diff.v[2];
-        state->time += delta_time;
-        break;
-      }
-    }
-    else if (state->action->type == ACTION_ROTATE_TO) {
-      struct character *c = state->character;
-      float target = state->action->rot;
-
-      if (state->action->speed > 0 && target < c->rotation) {
-        target += T3D_PI*2.f;
-      }
-      else if (state->action->speed < 0 && target > c->rotation) {
-        target -= T3D_PI*2.f;
-      }
-
-      float time_to_end = (target - c->rotation) / state->action->speed;
-      if (time_to_end - delta_time < EPS) {
-        delta_time -= time_to_end;
-        // Original, unchanged target
-        c->rotation = state->action->rot;
-      }
-      else {
-        c->rotation += state->action->speed * delta_time;
-        break;
-      }
-    }
-    else if (state->action->type == ACTION_PLAY_SFX) {
-      wav64_play(state->action->sfx, state->action->channel);
-    }
-    else if (state->action->type == ACTION_START_XM64) {
-      xm64player_play(state->action->xm64, state->action->first_channel);
-    }
-    else if (state->action->type == ACTION_MOVE_CAMERA_TO) {
-      float new_time = state->time + delta_time;
-
-      if (state->action->travel_time - new_time < EPS) {
-        delta_time -= new_time - state->action->travel_time;
-        cam.pos = state->action->pos;
-        cam.target = state->action->target;
-        t3d_viewport_look_at(&viewport,
-            &cam.pos,
-            &cam.target,
-            &(T3DVec3) {{0, 1, 0}});
-      }
-      else {
-        T3DVec3 end_angle;
-        t3d_vec3_diff(&end_angle, &state->action->target, &state->action->pos);
-        T3DVec3 cam_angle;
-        t3d_vec3_diff(&cam_angle, &cam.target, &cam.pos);
-        float time_left = state->action->travel_time - new_time;
-        for (size_t i = 0; i < 3; i++) {
-          float d = state->action->pos.v[i] - cam.pos.v[i];
-          cam.pos.v[i] += d * (delta_time / time_left);
-
-          d = end_angle.v[i] - cam_angle.v[i];
-          cam_angle.v[i] += d * (delta_time / time_left);
-        }
-
-        t3d_vec3_add(&cam.target, &cam.pos, &cam_angle);
-        t3d_viewport_look_at(&viewport,
-            &cam.pos,
-            &cam.target,
-            &(T3DVec3) {{0, 1, 0}});
-
-        state->time = new_time;
-        break;
-      }
-    }
-    else if (state->action->type == ACTION_SEND_SIGNAL) {
-      script_signals[state->action->signal] = true;
-    }
-    else if (state->action->type == ACTION_WAIT_FOR_SIGNAL) {
-      if (!script_signals[state->action->signal]) {
-        break;
-      }
-    }
-    else if (state->action->type == ACTION_ANIM_SET_PLAYING) {
-      struct character *c = state->character;
-      T3DAnim *anim = &c->s.anims[c->current_anim];
-      t3d_anim_set_playing(anim, state->action->playing);
-    }
-    else if (state->action->type == ACTION_ANIM_UPDATE_TO_TS) {
-      struct character *c = state->character;
-      T3DAnim *anim = &c->s.anims[c->current_anim];
-      t3d_anim_update(anim, state->action->time);
-    }
-    else if (state->action->type == ACTION_CALLBACK) {
-      state->action->callback();
-    }
-
-    state->action++;
-    state->time = 0.f;
-  }
-
-  return false;
-}
-
 rspq_block_t *build_empty_hud_block() {
   const color_t LINE_COLOR = RGBA32(0x00, 0x00, 0x00, 0xff);
   const color_t BAR_BG_COLOR = RGBA32(0x00, 0xc9, 0xff, 0xff);
@@ -100,6 +100,17 @@ struct script_state {
   struct character *character;
   const struct script_action *action;
   float time;
+
+  // Resolved once when the current action starts
+  bool started;
+  T3DAnim *anim;
+  float duration;
+  T3DVec3 velocity;
+  T3DVec3 angle_velocity;
+
+  // Waiting scripts sleep until then, without dispatching their action
+  float wake_time;
+  bool waiting_for_signal;
 };
 
 struct subgame {
@@ -81,9 +81,9 @@ struct lake_ai {
 
 extern T3DViewport viewport;
 extern struct character players[];
-extern wav64_t sfx_start;
-extern wav64_t sfx_stop;
-extern wav64_t sfx_winner;
+extern wav64_t* sfx_start;
+extern wav64_t* sfx_stop;
+extern wav64_t* sfx_winner;
 extern const char *const PLAYER_TITLES[];
 extern struct rdpq_textparms_s banner_params;
 extern struct rdpq_textparms_s timer_params;
@@ -933,7 +933,7 @@ static void lake_intro_dynamic_loop(float delta_time) {
   }
 
   if (done) {
-    wav64_play(&sfx_start, MINIGAME_CHANNEL);
+    wav64_play(sfx_start, MINIGAME_CHANNEL);
     lake_stage++;
   }
 }
@@ -1007,7 +1007,7 @@ static void lake_outro_dynamic_loop(float delta_time) {
         {.character = &players[i], .action = outro_actions[i+1], .time = 0.f};
     }
     delta_time = 0.f;
-    wav64_play(&sfx_stop, MINIGAME_CHANNEL);
+    wav64_play(sfx_stop, MINIGAME_CHANNEL);
   }
 
   bool done = true;
@@ -1059,7 +1059,7 @@ void lake_end_fixed_loop(float delta_time) {
     strcpy(banner_str, "DRAW");
   }
   xm64player_set_vol(&music, .5f);
-  wav64_play(&sfx_winner, MINIGAME_CHANNEL);
+  wav64_play(sfx_winner, MINIGAME_CHANNEL);
 }
 
 void lake_fade_out_fixed_loop(float delta_time) {
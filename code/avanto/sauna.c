@@ -55,10 +55,10 @@ extern struct camera cam;
 extern xm64player_t music;
 extern struct rdpq_textparms_s banner_params;
 extern struct rdpq_textparms_s timer_params;
-extern wav64_t sfx_countdown;
-extern wav64_t sfx_start;
-extern wav64_t sfx_stop;
-extern wav64_t sfx_winner;
+extern wav64_t* sfx_countdown;
+extern wav64_t* sfx_start;
+extern wav64_t* sfx_stop;
+extern wav64_t* sfx_winner;
 
 static T3DModel *ukko_model;
 static struct character ukko;
@@ -409,12 +409,12 @@ static void sauna_countdown_fixed_loop(float delta_time) {
       sprintf(banner_str, "%d", count);
       count--;
       next_step += 1.f;
-      wav64_play(&sfx_countdown, MINIGAME_CHANNEL);
+      wav64_play(sfx_countdown, MINIGAME_CHANNEL);
     }
     else {
       strcpy(banner_str, "START");
       sauna_stage++;
-      wav64_play(&sfx_start, MINIGAME_CHANNEL);
+      wav64_play(sfx_start, MINIGAME_CHANNEL);
       xm64player_set_vol(&music, 1.f);
     }
     banner_time = 1.f;
@@ -474,7 +474,7 @@ static void sauna_game_fixed_loop(float delta_time) {
   }
 
   if (time_left < EPS || all_out) {
-    wav64_play(&sfx_stop, MINIGAME_CHANNEL);
+    wav64_play(sfx_stop, MINIGAME_CHANNEL);
     sauna_stage++;
   }
 }
@@ -601,7 +601,7 @@ static void sauna_done_fixed_loop(float delta_time) {
   banner_time = INFINITY;
   end_when_over = true;
   xm64player_set_vol(&music, .5f);
-  wav64_play(&sfx_winner, MINIGAME_CHANNEL);
+  wav64_play(sfx_winner, MINIGAME_CHANNEL);
 }
 
 static bool sauna_fade_out_fixed_loop(float delta_time) {
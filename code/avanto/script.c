@@ -0,0 +1,259 @@
+#include <libdragon.h>
+#include <t3d/t3d.h>
+#include <t3d/t3dmodel.h>
+#include <t3d/t3dskeleton.h>
+#include <t3d/t3danim.h>
+#include <t3d/tpx.h>
+
+#include "common.h"
+
+// Kept apart from the rest of common.c, so the scripts can be run on the
+// host with stubbed libdragon and tiny3d headers
+
+extern T3DViewport viewport;
+extern struct camera cam;
+
+static bool script_signals[SCRIPT_NUM_SIGNALS];
+
+void script_reset_signals() {
+  for (size_t i = 0; i < SCRIPT_NUM_SIGNALS; i++) {
+    script_signals[i] = false;
+  }
+}
+
+// Advances a timed action, consuming the time it had left once it's over
+static bool script_advance(struct script_state *state, float *delta_time) {
+  float time_left = state->duration - state->time;
+  if (time_left - *delta_time < EPS) {
+    *delta_time -= time_left;
+    return true;
+  }
+  state->time += *delta_time;
+  return false;
+}
+
+static void script_attach_anim(struct script_state *state, size_t anim) {
+  struct character *c = state->character;
+  state->anim = &c->s.anims[anim];
+  c->current_anim = anim;
+  t3d_anim_attach(state->anim, &c->s.skeleton);
+  t3d_anim_set_playing(state->anim, true);
+}
+
+static bool script_wait(struct script_state *state, float *delta_time) {
+  if (!state->started) {
+    state->duration = state->action->time;
+    state->wake_time = state->duration;
+  }
+  return script_advance(state, delta_time);
+}
+
+static bool script_walk_to(struct script_state *state, float *delta_time) {
+  struct character *c = state->character;
+  if (!state->started) {
+    bool walk = state->action->type == ACTION_WALK_TO;
+    script_attach_anim(state, walk? WALK : CLIMB);
+    float dz = state->action->pos.v[2] - c->pos.v[2];
+    float dx = state->action->pos.v[0] - c->pos.v[0];
+    c->rotation = -fm_atan2f(dx, dz);
+
+    state->duration = walk?
+      sqrtf(dx*dx + dz*dz) / state->action->walk_speed:
+      state->anim->animRef->duration;
+    state->velocity = (T3DVec3) {{0}};
+    if (state->duration >= EPS) {
+      state->velocity.v[0] = dx / state->duration;
+      state->velocity.v[2] = dz / state->duration;
+    }
+  }
+
+  float step = *delta_time;
+  if (script_advance(state, delta_time)) {
+    c->pos.v[0] = state->action->pos.v[0];
+    c->pos.v[2] = state->action->pos.v[2];
+    return true;
+  }
+  c->pos.v[0] += state->velocity.v[0] * step;
+  c->pos.v[2] += state->velocity.v[2] * step;
+  return false;
+}
+
+static bool script_warp_to(struct script_state *state, float *delta_time) {
+  state->character->pos = state->action->pos;
+  return true;
+}
+
+static bool script_rotate_to(struct script_state *state, float *delta_time) {
+  struct character *c = state->character;
+  if (!state->started) {
+    float target = state->action->rot;
+    if (state->action->speed > 0 && target < c->rotation) {
+      target += T3D_PI*2.f;
+    }
+    else if (state->action->speed < 0 && target > c->rotation) {
+      target -= T3D_PI*2.f;
+    }
+    state->duration = (target - c->rotation) / state->action->speed;
+  }
+
+  float step = *delta_time;
+  if (script_advance(state, delta_time)) {
+    // Original, unchanged target
+    c->rotation = state->action->rot;
+    return true;
+  }
+  c->rotation += state->action->speed * step;
+  return false;
+}
+
+static bool script_start_anim(struct script_state *state, float *delta_time) {
+  script_attach_anim(state, state->action->anim);
+  return true;
+}
+
+static bool script_set_visibility(struct script_state *state, float *delta_time) {
+  state->character->visible = state->action->visibility;
+  return true;
+}
+
+static bool script_do_whole_anim(struct script_state *state, float *delta_time) {
+  if (!state->started) {
+    script_attach_anim(state, state->action->anim);
+    state->duration = state->anim->animRef->duration;
+  }
+  return script_advance(state, delta_time);
+}
+
+static bool script_play_sfx(struct script_state *state, float *delta_time) {
+  wav64_play(state->action->sfx, state->action->channel);
+  return true;
+}
+
+static bool script_start_xm64(struct script_state *state, float *delta_time) {
+  xm64player_play(state->action->xm64, state->action->first_channel);
+  return true;
+}
+
+static bool script_move_camera_to(struct script_state *state, float *delta_time) {
+  if (!state->started) {
+    state->duration = state->action->travel_time;
+    state->velocity = (T3DVec3) {{0}};
+    state->angle_velocity = (T3DVec3) {{0}};
+    if (state->duration >= EPS) {
+      T3DVec3 end_angle;
+      t3d_vec3_diff(&end_angle, &state->action->target, &state->action->pos);
+      T3DVec3 cam_angle;
+      t3d_vec3_diff(&cam_angle, &cam.target, &cam.pos);
+      for (size_t i = 0; i < 3; i++) {
+        state->velocity.v[i] = (state->action->pos.v[i] - cam.pos.v[i]) / state->duration;
+        state->angle_velocity.v[i] = (end_angle.v[i] - cam_angle.v[i]) / state->duration;
+      }
+    }
+  }
+
+  float step = *delta_time;
+  bool over = script_advance(state, delta_time);
+  if (over) {
+    cam.pos = state->action->pos;
+    cam.target = state->action->target;
+  }
+  else {
+    T3DVec3 cam_angle;
+    t3d_vec3_diff(&cam_angle, &cam.target, &cam.pos);
+    for (size_t i = 0; i < 3; i++) {
+      cam.pos.v[i] += state->velocity.v[i] * step;
+      cam_angle.v[i] += state->angle_velocity.v[i] * step;
+    }
+    t3d_vec3_add(&cam.target, &cam.pos, &cam_angle);
+  }
+
+  t3d_viewport_look_at(&viewport,
+      &cam.pos,
+      &cam.target,
+      &(T3DVec3) {{0, 1, 0}});
+  return over;
+}
+
+static bool script_wait_for_signal(struct script_state *state, float *delta_time) {
+  state->waiting_for_signal = !script_signals[state->action->signal];
+  return !state->waiting_for_signal;
+}
+
+static bool script_send_signal(struct script_state *state, float *delta_time) {
+  script_signals[state->action->signal] = true;
+  return true;
+}
+
+static bool script_anim_set_playing(struct script_state *state, float *delta_time) {
+  struct character *c = state->character;
+  t3d_anim_set_playing(&c->s.anims[c->current_anim], state->action->playing);
+  return true;
+}
+
+static bool script_anim_update_to_ts(struct script_state *state, float *delta_time) {
+  struct character *c = state->character;
+  t3d_anim_update(&c->s.anims[c->current_anim], state->action->time);
+  return true;
+}
+
+static bool script_callback(struct script_state *state, float *delta_time) {
+  state->action->callback();
+  return true;
+}
+
+// Runs the current action for up to delta_time, returns true once it's over
+static bool (*const script_action_funcs[ACTION_END])(struct script_state *,
+    float *) = {
+  [ACTION_WAIT] = script_wait,
+  [ACTION_WALK_TO] = script_walk_to,
+  [ACTION_WARP_TO] = script_warp_to,
+  [ACTION_CLIMB_TO] = script_walk_to,
+  [ACTION_ROTATE_TO] = script_rotate_to,
+  [ACTION_START_ANIM] = script_start_anim,
+  [ACTION_SET_VISIBILITY] = script_set_visibility,
+  [ACTION_DO_WHOLE_ANIM] = script_do_whole_anim,
+  [ACTION_PLAY_SFX] = script_play_sfx,
+  [ACTION_START_XM64] = script_start_xm64,
+  [ACTION_MOVE_CAMERA_TO] = script_move_camera_to,
+  [ACTION_WAIT_FOR_SIGNAL] = script_wait_for_signal,
+  [ACTION_SEND_SIGNAL] = script_send_signal,
+  [ACTION_ANIM_SET_PLAYING] = script_anim_set_playing,
+  [ACTION_ANIM_UPDATE_TO_TS] = script_anim_update_to_ts,
+  [ACTION_CALLBACK] = script_callback,
+};
+
+bool script_update(struct script_state *state, float delta_time) {
+  if (state->action->type == ACTION_END) {
+    return true;
+  }
+
+  // Sleeping scripts don't run their action until they wake up
+  if (state->waiting_for_signal
+      && !script_signals[state->action->signal]) {
+    return false;
+  }
+  if (state->wake_time - (state->time + delta_time) >= EPS) {
+    state->time += delta_time;
+    return false;
+  }
+
+  while (delta_time > EPS) {
+    if (state->action->type == ACTION_END) {
+      return true;
+    }
+
+    bool over = script_action_funcs[state->action->type](state, &delta_time);
+    state->started = true;
+    if (!over) {
+      break;
+    }
+
+    state->action++;
+    state->time = 0.f;
+    state->started = false;
+    state->wake_time = 0.f;
+    state->waiting_for_signal = false;
+  }
+
+  return false;
+}
@@ -1,7 +1,6 @@
 build/code/boss_fight/%.o: N64_CXXFLAGS += -std=gnu++20 -fno-exceptions -O2
 
-BOSS_FIGHT_assets_coll = $(wildcard assets/boss_fight/*.coll)
-BOSS_FIGHT_assets_scene = $(wildcard assets/boss_fight/*.scene)
+BOSS_FIGHT_assets_level = $(wildcard assets/boss_fight/*.level)
 
 BOSS_FIGHT_assets_png = $(wildcard assets/boss_fight/*.png) $(wildcard assets/boss_fight/grass/*.png) \
 	$(wildcard assets/boss_fight/ui/*.png) $(wildcard assets/boss_fight/ptx/*.png) \
@@ -12,32 +11,23 @@ BOSS_FIGHT_assets_ttf = $(wildcard assets/boss_fight/*.ttf)
 BOSS_FIGHT_assets_mp3 = $(wildcard assets/boss_fight/bgm/*.mp3)
 BOSS_FIGHT_assets_wav = $(wildcard assets/boss_fight/sfx/*.wav)
 
-BOSS_FIGHT_assets_conv = $(patsubst assets/%,filesystem/%,$(BOSS_FIGHT_assets_coll)) \
-              			 $(patsubst assets/%,filesystem/%,$(BOSS_FIGHT_assets_scene)) \
+BOSS_FIGHT_assets_conv = $(patsubst assets/%,filesystem/%,$(BOSS_FIGHT_assets_level)) \
               			 $(patsubst assets/%,filesystem/%,$(BOSS_FIGHT_assets_png:%.png=%.sprite)) \
               			 $(patsubst assets/%,filesystem/%,$(BOSS_FIGHT_assets_glb:%.glb=%.t3dm)) \
               			 $(patsubst assets/%,filesystem/%,$(BOSS_FIGHT_assets_ttf:%.ttf=%.font64)) \
               			 $(patsubst assets/%,filesystem/%,$(BOSS_FIGHT_assets_mp3:%.mp3=%.wav64)) \
               			 $(patsubst assets/%,filesystem/%,$(BOSS_FIGHT_assets_wav:%.wav=%.wav64))
 
-#assets/boss_fight/map.scene: assets/boss_fight/map.glb
-#	@echo "    [SCENE] $@"
-#	code/boss_fight/tools/gltf_to_scene "$<" assets/boss_fight/map.scene
+# Bakes actors, nav points and collision of map.glb into one pack, unchanged sources are served from the cache
+#assets/boss_fight/map.level: assets/boss_fight/map.glb
+#	@echo "    [LEVEL] $<"
+#	code/boss_fight/tools/gltf_to_assets --cache=$(BUILD_DIR)/asset_cache --level "$<"
 
-#assets/boss_fight/map.coll: assets/boss_fight/map.glb
-#	@echo "    [COLL] $@"
-#	code/boss_fight/tools/gltf_to_coll "$<" assets/boss_fight/map.coll
-
-filesystem/boss_fight/%.coll: assets/boss_fight/%.coll
+filesystem/boss_fight/%.level: assets/boss_fight/%.level
 	@mkdir -p $(dir $@)
-	@echo "    [COLL] $@"
+	@echo "    [LEVEL] $@"
 	$(N64_BINDIR)/mkasset -c 3 -w 256 -o filesystem/boss_fight "$<"
 
-filesystem/boss_fight/%.scene: assets/boss_fight/%.scene
-	@mkdir -p $(dir $@)
-	@echo "    [SCENE] $@"
-	$(N64_BINDIR)/mkasset -c 2 -w 256 -o filesystem/boss_fight "$<"
-
 BOSS_FIGHT_AUDIOCONV_FLAGS = --wav-resample 22050 --wav-mono
 
 filesystem/boss_fight/bgm/%.wav64: assets/boss_fight/bgm/%.mp3
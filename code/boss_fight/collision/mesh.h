@@ -28,6 +28,9 @@ namespace Coll
     [[nodiscard]] Coll::CollInfo vsFloorRay(const T3DVec3 &pos, const Triangle& triangle) const;
 
     static Mesh* load(const std::string &path);
+
+    // sets up a .coll file that is already in memory (e.g. inside a level pack), nothing is copied
+    static Mesh* fromData(void *fileData);
   };
 
   struct MeshInstance {
@@ -47,7 +47,12 @@ Coll::Mesh* Coll::Mesh::load(const std::string &path)
   Mesh* mesh = (Mesh*)asset_load(path.c_str(), &fileSize);
 
   //debugf("Loading collision mesh %s, size: %d\n", path.c_str(), fileSize);
+  return fromData(mesh);
+}
 
+Coll::Mesh* Coll::Mesh::fromData(void *fileData)
+{
+  Mesh* mesh = (Mesh*)fileData;
   char* data = (char*)&mesh->indices[0];
 
   data += mesh->triCount * sizeof(int16_t) * 3;
@@ -5,7 +5,6 @@
 #pragma once
 
 #include <t3d/t3dmath.h>
-#include <vector>
 
 namespace Coll
 {
@@ -16,10 +15,15 @@ namespace Coll
 
   struct NavPoints
   {
-    // points, internally sorted by X-coord
-    std::vector<T3DVec3> points{};
+    // points sorted by X-coord, owned by the level pack
+    const T3DVec3 *points{nullptr};
+    uint32_t count{0};
+
+    void setPoints(const T3DVec3 *sortedPoints, uint32_t pointCount) {
+      points = sortedPoints;
+      count = pointCount;
+    }
 
-    void addPoint(const T3DVec3 &point);
     NavPointsRes getClosest(const T3DVec3 &pos, float deltaX) const;
   };
 }
\ No newline at end of file
@@ -78,13 +78,13 @@ void Debug::Overlay::draw(Scene &scene, int triCount, float deltaTime) {
   collScene.debugDraw(showCollMesh, showCollSpheres);
 
   /*auto navPt = scene.getNavPoints();
-  for(const auto &point : navPt.points) {
-    auto ptWorld = point * COLL_WORLD_SCALE;
+  for(uint32_t i=0; i<navPt.count; ++i) {
+    auto ptWorld = navPt.points[i] * COLL_WORLD_SCALE;
     Debug::drawSphere(ptWorld, 8.0f, {0xFF,0x00,0x00, 0xFF});
   }*/
 
   if(actorDebug) {
-    for(const auto actor : scene.getActors()) {
+    for(const auto actor : scene.getActiveActors()) {
       actor->drawDebug();
     }
   }
@@ -113,7 +113,7 @@ void Debug::Overlay::draw(Scene &scene, int triCount, float deltaTime) {
   rdpq_set_prim_color({0xFF,0xFF,0xFF, 0xFF});
 
   posX = 24 + barWidth - 50;
-  posX = Debug::printf(posX, posY, "A:%d/%d", scene.activeActorCount, scene.drawActorCount) + 8;
+  posX = Debug::printf(posX, posY, "A:%d/%d/%d", scene.activeActorCount, scene.drawActorCount, (int)scene.getActorCount()) + 8;
   posX = Debug::printf(posX, posY, "T:%d", triCount) + 8;
   Debug::printf(posX, posY, "H:%d", heap_stats.used / 1024);
 
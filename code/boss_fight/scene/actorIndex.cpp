@@ -0,0 +1,112 @@
+/**
+* @copyright 2024 - Max Bebök
+* @license MIT
+*/
+#include "actorIndex.h"
+#include <algorithm>
+
+namespace {
+  constexpr float BUCKET_SIZE = 64.0f;
+  // actors are points in the index, this covers their models and a bit of movement
+  constexpr float LOOSE_MARGIN = 64.0f;
+
+  void growAABB(T3DVec3 &aabbMin, T3DVec3 &aabbMax, const T3DVec3 &pos) {
+    for(int i=0; i<3; ++i) {
+      aabbMin.v[i] = fminf(aabbMin.v[i], pos.v[i] - LOOSE_MARGIN);
+      aabbMax.v[i] = fmaxf(aabbMax.v[i], pos.v[i] + LOOSE_MARGIN);
+    }
+  }
+
+  void eraseActor(std::vector<Actor::Base*> &list, Actor::Base *actor) {
+    auto it = std::find(list.begin(), list.end(), actor);
+    if(it == list.end())return;
+    *it = list.back();
+    list.pop_back();
+  }
+}
+
+void ActorIndex::init(float extentMinX, float extentMaxX) {
+  minX = extentMinX;
+  int count = (int)((extentMaxX - extentMinX) / BUCKET_SIZE) + 1;
+  buckets.clear();
+  buckets.resize(count < 1 ? 1 : count);
+  for(auto &bucket : buckets) {
+    bucket.aabbMin = {{ 999999.0f,  999999.0f,  999999.0f}};
+    bucket.aabbMax = {{-999999.0f, -999999.0f, -999999.0f}};
+  }
+  unbounded.clear();
+}
+
+int ActorIndex::getBucketIndex(float posX) const {
+  int idx = (int)((posX - minX) / BUCKET_SIZE);
+  return std::clamp(idx, 0, (int)buckets.size() - 1);
+}
+
+void ActorIndex::addToBucket(Actor::Base *actor, int bucketIdx) {
+  auto &bucket = buckets[bucketIdx];
+  bucket.actors.push_back(actor);
+  actor->indexBucket = bucketIdx;
+  growAABB(bucket.aabbMin, bucket.aabbMax, actor->getPos() * COLL_WORLD_SCALE);
+}
+
+void ActorIndex::removeFromBucket(Actor::Base *actor) {
+  eraseActor(buckets[actor->indexBucket].actors, actor);
+  actor->indexBucket = -1;
+}
+
+void ActorIndex::insert(Actor::Base *actor) {
+  if(actor->alwaysUpdate) {
+    unbounded.push_back(actor);
+    return;
+  }
+  addToBucket(actor, getBucketIndex(actor->getPos().x * COLL_WORLD_SCALE));
+}
+
+void ActorIndex::remove(Actor::Base *actor) {
+  if(actor->indexBucket < 0) {
+    eraseActor(unbounded, actor);
+    return;
+  }
+  removeFromBucket(actor);
+}
+
+void ActorIndex::update(Actor::Base *actor) {
+  if(actor->indexBucket < 0)return;
+
+  int newIdx = getBucketIndex(actor->getPos().x * COLL_WORLD_SCALE);
+  if(newIdx != actor->indexBucket) {
+    removeFromBucket(actor);
+    addToBucket(actor, newIdx);
+    return;
+  }
+
+  // same bucket, only make sure the bounds still contain it
+  auto &bucket = buckets[newIdx];
+  growAABB(bucket.aabbMin, bucket.aabbMax, actor->getPos() * COLL_WORLD_SCALE);
+}
+
+void ActorIndex::queryRange(float rangeMinX, float rangeMaxX, std::vector<Actor::Base*> &res) const {
+  res.clear();
+  res.insert(res.end(), unbounded.begin(), unbounded.end());
+
+  int idxEnd = getBucketIndex(rangeMaxX);
+  for(int i = getBucketIndex(rangeMinX); i <= idxEnd; ++i) {
+    for(auto actor : buckets[i].actors) {
+      float posX = actor->getPos().x * COLL_WORLD_SCALE;
+      if(posX >= rangeMinX && posX <= rangeMaxX) {
+        res.push_back(actor);
+      }
+    }
+  }
+}
+
+void ActorIndex::queryFrustum(const T3DFrustum &frustum, std::vector<Actor::Base*> &res) const {
+  res.clear();
+  res.insert(res.end(), unbounded.begin(), unbounded.end());
+
+  for(const auto &bucket : buckets) {
+    if(bucket.actors.empty())continue;
+    if(!t3d_frustum_vs_aabb(&frustum, &bucket.aabbMin, &bucket.aabbMax))continue;
+    res.insert(res.end(), bucket.actors.begin(), bucket.actors.end());
+  }
+}
@@ -0,0 +1,45 @@
+/**
+* @copyright 2024 - Max Bebök
+* @license MIT
+*/
+#pragma once
+
+#include <t3d/t3dmath.h>
+#include <vector>
+#include "actors/base.h"
+
+/**
+ * Loose 1D index of all actors along the scroll axis (X).
+ * Actors are put into fixed-size buckets by their position, the bounds of a bucket
+ * only ever grow, so they stay conservative for culling while actors move around.
+ * Actors with 'alwaysUpdate' set are kept outside the buckets and returned by every query.
+ */
+class ActorIndex
+{
+  private:
+    struct Bucket {
+      std::vector<Actor::Base*> actors{};
+      T3DVec3 aabbMin{};
+      T3DVec3 aabbMax{};
+    };
+
+    std::vector<Bucket> buckets{};
+    std::vector<Actor::Base*> unbounded{};
+    float minX{};
+
+    [[nodiscard]] int getBucketIndex(float posX) const;
+    void addToBucket(Actor::Base *actor, int bucketIdx);
+    void removeFromBucket(Actor::Base *actor);
+
+  public:
+    // in render units, the extent only affects performance, actors outside of it are clamped
+    void init(float extentMinX, float extentMaxX);
+
+    void insert(Actor::Base *actor);
+    void remove(Actor::Base *actor);
+    // needs to be called after an actor may have moved
+    void update(Actor::Base *actor);
+
+    void queryRange(float rangeMinX, float rangeMaxX, std::vector<Actor::Base*> &res) const;
+    void queryFrustum(const T3DFrustum &frustum, std::vector<Actor::Base*> &res) const;
+};
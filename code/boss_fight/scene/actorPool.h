@@ -0,0 +1,83 @@
+/**
+* @copyright 2024 - Max Bebök
+* @license MIT
+*/
+#pragma once
+
+#include <vector>
+#include <new>
+#include <utility>
+
+/**
+ * Storage for all actors of a single type.
+ * Actors live in fixed-size blocks of contiguous memory and never move once created,
+ * so collision shapes and callbacks can keep pointing to them.
+ * Freed slots are reused by the next actor of the same type.
+ */
+template<typename T, uint32_t BLOCK_SIZE = 32>
+class ActorPool
+{
+  static_assert(BLOCK_SIZE <= 32, "Slot mask only has 32 bits");
+
+  private:
+    static constexpr uint32_t MASK_FULL = BLOCK_SIZE == 32 ? 0xFFFF'FFFF : ((1u << BLOCK_SIZE) - 1);
+
+    struct Block {
+      alignas(T) uint8_t data[sizeof(T) * BLOCK_SIZE];
+      uint32_t usedMask{0};
+
+      [[nodiscard]] T* get(uint32_t idx) { return reinterpret_cast<T*>(data) + idx; }
+      [[nodiscard]] bool contains(const T* actor) {
+        return actor >= get(0) && actor < get(BLOCK_SIZE);
+      }
+    };
+
+    std::vector<Block*> blocks{};
+    uint32_t count{0};
+
+  public:
+    template<typename ...Args>
+    T* create(Args&&... args) {
+      Block *block = nullptr;
+      for(auto b : blocks) {
+        if(b->usedMask != MASK_FULL) { block = b; break; }
+      }
+      if(!block) {
+        block = new Block();
+        blocks.push_back(block);
+      }
+
+      uint32_t idx = __builtin_ctz(~block->usedMask);
+      block->usedMask |= 1u << idx;
+      ++count;
+      return new(block->get(idx)) T(std::forward<Args>(args)...);
+    }
+
+    void destroy(T* actor) {
+      for(auto b : blocks) {
+        if(!b->contains(actor))continue;
+        actor->~T();
+        b->usedMask &= ~(1u << (actor - b->get(0)));
+        --count;
+        return;
+      }
+    }
+
+    void clear() {
+      for(auto b : blocks) {
+        for(uint32_t i=0; i<BLOCK_SIZE; ++i) {
+          if(b->usedMask & (1u << i))b->get(i)->~T();
+        }
+        delete b;
+      }
+      blocks.clear();
+      count = 0;
+    }
+
+    [[nodiscard]] uint32_t size() const { return count; }
+
+    ActorPool() = default;
+    ActorPool(const ActorPool&) = delete;
+    ActorPool& operator=(const ActorPool&) = delete;
+    ~ActorPool() { clear(); }
+};
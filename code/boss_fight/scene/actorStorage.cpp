@@ -0,0 +1,147 @@
+/**
+* @copyright 2024 - Max Bebök
+* @license MIT
+*/
+#include "actorStorage.h"
+#include <algorithm>
+
+using Actor::Type;
+
+namespace {
+  using ActorSpan = std::span<Actor::Base* const>;
+
+  // calls 'fn' for each run of actors with the same type, list must be sorted
+  template<typename FN>
+  void forEachRun(ActorSpan actors, FN fn) {
+    uint32_t start = 0;
+    while(start < actors.size()) {
+      Type type = actors[start]->type;
+      uint32_t end = start + 1;
+      while(end < actors.size() && actors[end]->type == type)++end;
+      fn(type, actors.subspan(start, end - start));
+      start = end;
+    }
+  }
+
+  // all actor types are 'final', so casting to the type makes these direct calls
+  template<typename T>
+  void updateRun(ActorSpan actors, float deltaTime) {
+    for(auto actor : actors)static_cast<T*>(actor)->update(deltaTime);
+  }
+
+  template<typename T>
+  void draw3DRun(ActorSpan actors, float deltaTime) {
+    for(auto actor : actors)static_cast<T*>(actor)->draw3D(deltaTime);
+  }
+
+  template<typename T>
+  void drawPtxRun(ActorSpan actors, float deltaTime) {
+    for(auto actor : actors)static_cast<T*>(actor)->drawPtx(deltaTime);
+  }
+
+  template<typename T>
+  void draw2DRun(ActorSpan actors, float deltaTime) {
+    for(auto actor : actors)static_cast<T*>(actor)->draw2D(deltaTime);
+  }
+}
+
+Actor::Base* ActorStorage::create(Scene &scene, uint32_t type, const T3DVec3 &pos, uint16_t param) {
+  switch(type) {
+    case "Coin"_u32: return coins.create(scene, pos, param);
+    case "Grss"_u32: return grass.create(scene, pos, param);
+    case "Boss"_u32: return bosses.create(scene, pos, param);
+    case "Part"_u32: return particles.create(scene, pos, param);
+    case "Vase"_u32: return vases.create(scene, pos, param);
+    case "WBox"_u32: return boxes.create(scene, pos, param);
+    case "Void"_u32: return voids.create(scene, pos, param);
+    case "TCan"_u32: return cans.create(scene, pos, param);
+    default:
+      debugf("Unknown actor %08lX pos=%f,%f,%f param=%d\n", type, pos.x, pos.y, pos.z, param);
+      return nullptr;
+  }
+}
+
+void ActorStorage::destroy(Actor::Base *actor) {
+  switch(actor->type) {
+    case Type::COIN     : coins.destroy(static_cast<Actor::Coin*>(actor)); break;
+    case Type::GRASS    : grass.destroy(static_cast<Actor::Grass*>(actor)); break;
+    case Type::VASE     : vases.destroy(static_cast<Actor::Vase*>(actor)); break;
+    case Type::BOX      : boxes.destroy(static_cast<Actor::Box*>(actor)); break;
+    case Type::CAN      : cans.destroy(static_cast<Actor::Can*>(actor)); break;
+    case Type::VOID     : voids.destroy(static_cast<Actor::Void*>(actor)); break;
+    case Type::PARTICLES: particles.destroy(static_cast<Actor::Particles*>(actor)); break;
+    case Type::BOSS     : bosses.destroy(static_cast<Actor::Boss*>(actor)); break;
+    default: break;
+  }
+}
+
+void ActorStorage::clear() {
+  coins.clear();
+  grass.clear();
+  vases.clear();
+  boxes.clear();
+  cans.clear();
+  voids.clear();
+  particles.clear();
+  bosses.clear();
+}
+
+uint32_t ActorStorage::size() const {
+  return coins.size() + grass.size() + vases.size() + boxes.size()
+    + cans.size() + voids.size() + particles.size() + bosses.size();
+}
+
+void ActorStorage::sortByType(std::vector<Actor::Base*> &actors) {
+  // within a type, address order walks the pool blocks linearly
+  std::sort(actors.begin(), actors.end(), [](const Actor::Base *a, const Actor::Base *b) {
+    return a->type != b->type ? a->type < b->type : a < b;
+  });
+}
+
+void ActorStorage::update(ActorSpan actors, float deltaTime) {
+  forEachRun(actors, [deltaTime](Type type, ActorSpan run) {
+    switch(type) {
+      case Type::COIN     : updateRun<Actor::Coin>(run, deltaTime); break;
+      case Type::GRASS    : updateRun<Actor::Grass>(run, deltaTime); break;
+      case Type::VASE     : updateRun<Actor::Vase>(run, deltaTime); break;
+      case Type::BOX      : updateRun<Actor::Box>(run, deltaTime); break;
+      case Type::CAN      : updateRun<Actor::Can>(run, deltaTime); break;
+      case Type::VOID     : updateRun<Actor::Void>(run, deltaTime); break;
+      case Type::PARTICLES: updateRun<Actor::Particles>(run, deltaTime); break;
+      case Type::BOSS     : updateRun<Actor::Boss>(run, deltaTime); break;
+      default: break;
+    }
+  });
+}
+
+void ActorStorage::draw3D(Scene &scene, ActorSpan actors, float deltaTime) {
+  forEachRun(actors, [&scene, deltaTime](Type type, ActorSpan run) {
+    switch(type) {
+      case Type::VASE: Actor::Vase::draw3DBatch(scene, run); break;
+      case Type::BOX : Actor::Box::draw3DBatch(scene, run); break;
+      case Type::CAN : Actor::Can::draw3DBatch(scene, run); break;
+      case Type::VOID: draw3DRun<Actor::Void>(run, deltaTime); break;
+      case Type::BOSS: draw3DRun<Actor::Boss>(run, deltaTime); break;
+      default: break;
+    }
+  });
+}
+
+void ActorStorage::drawPtx(ActorSpan actors, float deltaTime) {
+  forEachRun(actors, [deltaTime](Type type, ActorSpan run) {
+    switch(type) {
+      case Type::GRASS: Actor::Grass::drawPtxBatch(run); break;
+      case Type::VOID : drawPtxRun<Actor::Void>(run, deltaTime); break;
+      default: break;
+    }
+  });
+}
+
+void ActorStorage::draw2D(ActorSpan actors, float deltaTime) {
+  forEachRun(actors, [deltaTime](Type type, ActorSpan run) {
+    switch(type) {
+      case Type::BOSS: draw2DRun<Actor::Boss>(run, deltaTime); break;
+      default: break;
+    }
+  });
+}
@@ -0,0 +1,53 @@
+/**
+* @copyright 2024 - Max Bebök
+* @license MIT
+*/
+#pragma once
+
+#include <span>
+#include <vector>
+#include "actorPool.h"
+#include "actors/coin.h"
+#include "actors/grass.h"
+#include "actors/vase.h"
+#include "actors/box.h"
+#include "actors/can.h"
+#include "actors/void.h"
+#include "actors/particles.h"
+#include "actors/boss.h"
+
+/**
+ * Owns all actors, partitioned by type into separate pools.
+ * Lists passed to the update/draw functions are expected to be sorted with 'sortByType',
+ * each run of the same type is then handled in one go without virtual calls.
+ * Drawing a run lets the type set up its material once for all instances.
+ */
+class ActorStorage
+{
+  private:
+    ActorPool<Actor::Coin> coins{};
+    ActorPool<Actor::Grass, 8> grass{};
+    ActorPool<Actor::Vase> vases{};
+    ActorPool<Actor::Box> boxes{};
+    ActorPool<Actor::Can> cans{};
+    ActorPool<Actor::Void, 4> voids{};
+    ActorPool<Actor::Particles> particles{};
+    ActorPool<Actor::Boss, 1> bosses{};
+
+  public:
+    Actor::Base* create(Scene &scene, uint32_t type, const T3DVec3 &pos, uint16_t param);
+    void destroy(Actor::Base *actor);
+    void clear();
+
+    [[nodiscard]] uint32_t size() const;
+
+    static void sortByType(std::vector<Actor::Base*> &actors);
+
+    static void update(std::span<Actor::Base* const> actors, float deltaTime);
+    static void draw3D(Scene &scene, std::span<Actor::Base* const> actors, float deltaTime);
+    static void drawPtx(std::span<Actor::Base* const> actors, float deltaTime);
+    static void draw2D(std::span<Actor::Base* const> actors, float deltaTime);
+
+    ActorStorage() = default;
+    ~ActorStorage() { clear(); }
+};
@@ -16,6 +16,12 @@ namespace Actor
   constexpr uint8_t DRAW_MASK_2D  = 1 << 1;
   constexpr uint8_t DRAW_MASK_PTX = 1 << 2;
 
+  // each type has its own pool, update and draw are batched per type in this order
+  enum class Type : uint8_t {
+    COIN = 0, GRASS, VASE, BOX, CAN, VOID, PARTICLES, BOSS,
+    COUNT
+  };
+
   class Base
   {
     protected:
@@ -23,15 +29,19 @@ namespace Actor
       Scene& scene;
 
     public:
+      const Type type;
       uint8_t deleteFlag{false};
       uint8_t drawMask{};
+      // skip the spatial index, for actors that move on their own or have no single position
+      uint8_t alwaysUpdate{false};
+      int16_t indexBucket{-1};
 
       void requestDelete() { deleteFlag = true; }
       [[nodiscard]] const T3DVec3 &getPos() const { return coll.center; }
 
       bool checkCulling(float distance);
 
-      explicit Base(Scene& scene) : scene(scene) {}
+      Base(Scene& scene, Type type) : scene(scene), type(type) {}
       virtual ~Base() = default;
 
       virtual void update(float deltaTime) = 0;
@@ -30,9 +30,10 @@ namespace {
 }
 
 Actor::Boss::Boss(Scene &scene, const T3DVec3 &pos, uint16_t param)
-  : Base(scene)
+  : Base(scene, Type::BOSS)
 {
   drawMask = DRAW_MASK_3D | DRAW_MASK_2D;
+  alwaysUpdate = true; // uses its own colliders, the base position is unused
 
   assert(model == nullptr); // single instance
   model = t3d_model_load(FS_BASE_PATH "obj/boss.t3dm");
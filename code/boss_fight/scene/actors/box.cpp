@@ -16,7 +16,7 @@ namespace
 }
 
 Actor::Box::Box(Scene &scene, const T3DVec3 &pos, uint16_t param)
-  : Base(scene), param{param}
+  : Base(scene, Type::BOX), param{param}
 {
   if(refCount++ == 0) {
     model = t3d_model_load(FS_BASE_PATH "obj/box.t3dm");
@@ -149,8 +149,10 @@ void Actor::Box::update(float deltaTime)
   }
 }
 
-void Actor::Box::draw3D(float deltaTime) {
+void Actor::Box::draw3DBatch(Scene &scene, std::span<Base* const> actors) {
   t3d_model_draw_material(obj->material, &scene.t3dState);
-  t3d_matrix_set(matFP, true);
-  rspq_block_run(obj->userBlock);
+  for(auto actor : actors) {
+    t3d_matrix_set(static_cast<Box*>(actor)->matFP, true);
+    rspq_block_run(obj->userBlock);
+  }
 }
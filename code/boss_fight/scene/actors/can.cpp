@@ -12,7 +12,7 @@ namespace {
 }
 
 Actor::Can::Can(Scene &scene, const T3DVec3 &pos, uint16_t param)
-: Base(scene), basePos{pos}
+: Base(scene, Type::CAN), basePos{pos}
 {
   if(refCount++ == 0) {
     model = t3d_model_load(FS_BASE_PATH "obj/can.t3dm");
@@ -92,12 +92,14 @@ void Actor::Can::update(float deltaTime) {
   );
 }
 
-void Actor::Can::draw3D(float deltaTime) {
-  t3d_matrix_set(matFP, true);
-
+void Actor::Can::draw3DBatch(Scene &scene, std::span<Base* const> actors) {
+  // object-major: each material is set once, all cans then draw that part
   auto it = t3d_model_iter_create(model, T3D_CHUNK_TYPE_OBJECT);
   while(t3d_model_iter_next(&it)) {
     t3d_model_draw_material(it.object->material, &scene.t3dState);
-    rspq_block_run(it.object->userBlock);
+    for(auto actor : actors) {
+      t3d_matrix_set(static_cast<Can*>(actor)->matFP, true);
+      rspq_block_run(it.object->userBlock);
+    }
   }
 }
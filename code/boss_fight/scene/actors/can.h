@@ -4,6 +4,7 @@
 */
 #pragma once
 #include <t3d/t3dskeleton.h>
+#include <span>
 #include "base.h"
 #include "../../collision/shapes.h"
 
@@ -24,6 +25,8 @@ namespace Actor
       ~Can() final;
 
       void update(float deltaTime) final;
-      void draw3D(float deltaTime) final;
+
+      // draws all instances in 'actors' (all of this type) with one material setup
+      static void draw3DBatch(Scene &scene, std::span<Base* const> actors);
   };
 }
\ No newline at end of file
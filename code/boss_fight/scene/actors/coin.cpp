@@ -16,9 +16,10 @@ namespace {
 }
 
 Actor::Coin::Coin(Scene &scene, const T3DVec3 &pos, uint16_t param)
-  : Base(scene), param{param}
+  : Base(scene, Type::COIN), param{param}
 {
   drawMask = 0;
+  alwaysUpdate = isDynamic(); // may fly off, see 'update'
   floorPosY = pos.y * COLL_WORLD_SCALE;
 
   coll = {
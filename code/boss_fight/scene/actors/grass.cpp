@@ -66,7 +66,7 @@ namespace
 }
 
 Actor::Grass::Grass(Scene &scene, const T3DVec3 &pos, uint16_t param)
-  : Base(scene), ptSystem{64*10}
+  : Base(scene, Type::GRASS), ptSystem{64*10}
 {
   if(refCount++ == 0) {
     sprite = sprite_load(FS_BASE_PATH "grass/blade.i8.sprite");
@@ -200,7 +200,7 @@ void Actor::Grass::update(float deltaTime)
   }
 }
 
-void Actor::Grass::drawPtx(float deltaTime) {
+void Actor::Grass::drawPtxBatch(std::span<Base* const> actors) {
   rdpq_sync_pipe();
   rdpq_mode_filter(FILTER_POINT);
   rdpq_mode_alphacompare(10);
@@ -218,18 +218,22 @@ void Actor::Grass::drawPtx(float deltaTime) {
 
   tpx_state_set_tex_params(0, 0);
   tpx_state_set_scale(0.4f, 0.8f);
-  ptSystem.drawTextured();
+  for(auto actor : actors) {
+    static_cast<Grass*>(actor)->ptSystem.drawTextured();
+  }
 
   bool hadMatUpdate = false;
-  for(auto &fx : ptFX) {
-    if(fx.timer > 0.0f) {
-      if(!hadMatUpdate) {
-        rdpq_sync_pipe();
-        rdpq_mode_combiner(RDPQ_COMBINER_FLAT);
-        hadMatUpdate = true;
+  for(auto actor : actors) {
+    for(auto &fx : static_cast<Grass*>(actor)->ptFX) {
+      if(fx.timer > 0.0f) {
+        if(!hadMatUpdate) {
+          rdpq_sync_pipe();
+          rdpq_mode_combiner(RDPQ_COMBINER_FLAT);
+          hadMatUpdate = true;
+        }
+        tpx_state_set_scale(fx.timer+0.125f, fx.timer+0.125f);
+        fx.drawTextured();
       }
-      tpx_state_set_scale(fx.timer+0.125f, fx.timer+0.125f);
-      fx.drawTextured();
     }
   }
 }
@@ -3,6 +3,7 @@
 * @license MIT
 */
 #pragma once
+#include <span>
 #include "base.h"
 #include "../../collision/shapes.h"
 #include "../../render/ptSystem.h"
@@ -23,7 +24,8 @@ namespace Actor
       ~Grass() final;
 
       void update(float deltaTime) final;
-      void drawPtx(float deltaTime) final;
+      // draws all instances in 'actors' (all of this type) with one texture upload
+      static void drawPtxBatch(std::span<Base* const> actors);
 
       void drawDebug() final;
   };
@@ -12,7 +12,7 @@ namespace {
 }
 
 Actor::Particles::Particles(Scene &scene, const T3DVec3 &pos, uint16_t param)
-: Base(scene)
+: Base(scene, Type::PARTICLES)
 {
   timer = 0;
   coll.center = pos;
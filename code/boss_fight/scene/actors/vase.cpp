@@ -16,7 +16,7 @@ namespace
 }
 
 Actor::Vase::Vase(Scene &scene, const T3DVec3 &pos, uint16_t param)
-  : Base(scene), param{param}
+  : Base(scene, Type::VASE), param{param}
 {
   if(refCount++ == 0) {
     for(auto &rot : randomRot) {
@@ -131,15 +131,27 @@ void Actor::Vase::update(float deltaTime)
   }
 }
 
-void Actor::Vase::draw3D(float deltaTime) {
-  if(timer >= 0.0f) {
-    t3d_model_draw_material(objBroken->material, &scene.t3dState);
-    t3d_matrix_set(matFP, true);
-    t3d_segment_set(1, skeleton.boneMatricesFP);
-    rspq_block_run(objBroken->userBlock);
-  } else {
-    t3d_model_draw_material(obj->material, &scene.t3dState);
-    t3d_matrix_set(matFP, true);
+void Actor::Vase::draw3DBatch(Scene &scene, std::span<Base* const> actors) {
+  // intact vases first, broken ones (timer running) share the other material
+  bool hasBroken = false;
+  t3d_model_draw_material(obj->material, &scene.t3dState);
+  for(auto actor : actors) {
+    auto vase = static_cast<Vase*>(actor);
+    if(vase->timer >= 0.0f) {
+      hasBroken = true;
+      continue;
+    }
+    t3d_matrix_set(vase->matFP, true);
     rspq_block_run(obj->userBlock);
   }
+
+  if(!hasBroken)return;
+  t3d_model_draw_material(objBroken->material, &scene.t3dState);
+  for(auto actor : actors) {
+    auto vase = static_cast<Vase*>(actor);
+    if(vase->timer < 0.0f)continue;
+    t3d_matrix_set(vase->matFP, true);
+    t3d_segment_set(1, vase->skeleton.boneMatricesFP);
+    rspq_block_run(objBroken->userBlock);
+  }
 }
@@ -19,7 +19,7 @@ namespace
 }
 
 Actor::Void::Void(Scene &scene, const T3DVec3 &pos, uint16_t param)
-  : Base(scene), param{param}
+  : Base(scene, Type::VOID), param{param}
 {
   if(refCount++ == 0) {
     model = t3d_model_load(FS_BASE_PATH "obj/void.t3dm");
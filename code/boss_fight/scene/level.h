@@ -0,0 +1,60 @@
+/**
+* @copyright 2024 - Max Bebök
+* @license MIT
+*/
+#pragma once
+#include <t3d/t3dmath.h>
+
+namespace Level
+{
+  constexpr uint32_t VERSION = 1;
+
+  struct Actor {
+    uint32_t type{};
+    int16_t pos[3]{};
+    uint16_t param{};
+  };
+
+  // Actors are grouped into sections along X (file units, 64 per unit)
+  struct Section {
+    int16_t minX{};
+    int16_t maxX{};
+    uint16_t firstActor{};
+    uint16_t actorCount{};
+  };
+
+  /**
+   * Level pack baked by 'gltf_to_scene' (.level), loaded with a single 'asset_load'.
+   * NOTE: mirrors the file format, all sections are used in place
+   */
+  struct Pack {
+    char magic[4]; // "BFLV"
+    uint32_t version;
+    uint32_t actorCount;
+    uint32_t specialCount; // 'Spwn', 'Rset' and 'CEnd' come first and are never spawned
+    uint32_t sectionCount;
+    uint32_t navPointCount;
+    uint32_t offsetActors;
+    uint32_t offsetSections;
+    uint32_t offsetNavPoints;
+    uint32_t offsetColl;
+
+    [[nodiscard]] const Actor* getActors() const {
+      return (const Actor*)((const char*)this + offsetActors);
+    }
+
+    [[nodiscard]] const Section* getSections() const {
+      return (const Section*)((const char*)this + offsetSections);
+    }
+
+    // sorted by X, already in world units
+    [[nodiscard]] const T3DVec3* getNavPoints() const {
+      return (const T3DVec3*)((const char*)this + offsetNavPoints);
+    }
+
+    // .coll data, see 'Coll::Mesh::fromData'
+    [[nodiscard]] void* getColl() {
+      return (char*)this + offsetColl;
+    }
+  };
+}
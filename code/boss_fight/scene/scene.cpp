@@ -9,14 +9,6 @@
 #include "../debug/overlay.h"
 #include "../render/screenFX.h"
 
-#include "actors/coin.h"
-#include "actors/grass.h"
-#include "actors/boss.h"
-#include "actors/particles.h"
-#include "actors/vase.h"
-#include "actors/box.h"
-#include "actors/void.h"
-#include "actors/can.h"
 #include "../utils/memory.h"
 
 namespace {
@@ -26,6 +18,10 @@ namespace {
 
   constexpr float FADE_TIME_MAX = 2.0f;
 
+  // largest distances used in 'checkCulling', behind the camera actors still need a visit to get deleted
+  constexpr float ACTOR_UPDATE_DIST_FRONT = 200.0f;
+  constexpr float ACTOR_UPDATE_DIST_BACK = 256.0f;
+
   bool needsDetach = false;
   bool showFPS = false;
   bool debugOverlay = false;
@@ -76,25 +72,20 @@ Scene::Scene()
 
   initCutscenes();
   texGo = sprite_load(FS_BASE_PATH "ui/txtGo.ia8.sprite");
-  collMesh = Coll::Mesh::load(FS_BASE_PATH "map.coll");
-  collMeshInstance.mesh = collMesh;
-  collScene.registerMesh(&collMeshInstance);
-
   viewport = t3d_viewport_create();
   cam.reset();
 
-  loadScene(FS_BASE_PATH "map.scene");
+  loadLevel(FS_BASE_PATH "map.level");
   cam.setTarget({{getPlayer(0).getPos().x*COLL_WORLD_SCALE, 0, -8}});
+  streamActors();
 
   changeState(State::INTRO);
 }
 
 Scene::~Scene() {
-  for(auto actor : actors) {
-    delete actor;
-  }
+  actorStorage.clear();
 
-  free(collMesh);
+  free(level); // also owns 'collMesh'
   Shadows::destroy();
   Debug::destroy();
   sprite_free(texGo);
@@ -121,25 +112,28 @@ const T3DVec3& Scene::getClosesRespawn(const T3DVec3 &pos) const {
 }
 
 void Scene::spawnActor(uint32_t type, const T3DVec3 &pos, uint16_t param) {
-  switch(type) {
-    case "Coin"_u32: actors.push_back(new Actor::Coin(*this, pos, param)); break;
-    case "Grss"_u32: actors.push_back(new Actor::Grass(*this, pos, param)); break;
-    case "Boss"_u32: actors.push_back(new Actor::Boss(*this, pos, param)); break;
-    case "Part"_u32: actors.push_back(new Actor::Particles(*this, pos, param)); break;
-    case "Vase"_u32: actors.push_back(new Actor::Vase(*this, pos, param)); break;
-    case "WBox"_u32: actors.push_back(new Actor::Box(*this, pos, param)); break;
-    case "Void"_u32: actors.push_back(new Actor::Void(*this, pos, param)); break;
-    case "TCan"_u32: actors.push_back(new Actor::Can(*this, pos, param)); break;
-    default:
-      debugf("Unknown actor %08lX pos=%f,%f,%f param=%d\n", type, pos.x, pos.y, pos.z, param);
-    break;
-  }
+  Actor::Base *actor = actorStorage.create(*this, type, pos, param);
+  if(actor)actorIndex.insert(actor);
 }
 
 void Scene::updateVisibility()
 {
   ticksCull = get_ticks();
   mapModel.update(cam.getTarget());
+
+  actorIndex.queryFrustum(t3d_viewport_get()->viewFrustum, actorsVisible);
+  ActorStorage::sortByType(actorsVisible);
+
+  actorsDraw3D.clear();
+  actorsDrawPtx.clear();
+  actorsDraw2D.clear();
+  drawActorCount = 0;
+  for(auto actor : actorsVisible) {
+    if(actor->drawMask & Actor::DRAW_MASK_3D)actorsDraw3D.push_back(actor);
+    if(actor->drawMask & Actor::DRAW_MASK_PTX)actorsDrawPtx.push_back(actor);
+    if(actor->drawMask & Actor::DRAW_MASK_2D)actorsDraw2D.push_back(actor);
+    if(actor->drawMask != 0)++drawActorCount;
+  }
   ticksCull = get_ticks() - ticksCull;
 }
 
@@ -265,6 +259,7 @@ void Scene::updateGame(float deltaTime)
     players[i].update(input[i], deltaTime);
   }
 
+  streamActors();
   if(!actorSpawnReqs.empty()) {
     for(auto &spawnReq : actorSpawnReqs) {
       spawnActor(spawnReq.type, spawnReq.pos, spawnReq.param);
@@ -272,23 +267,24 @@ void Scene::updateGame(float deltaTime)
     actorSpawnReqs.clear();
   }
 
-  activeActorCount = actors.size();
-  drawActorCount = 0;
+  // actors further away are idle anyway (see 'Actor::Base::checkCulling'), so don't even visit them
+  float camPosX = cam.getTarget().x;
+  actorIndex.queryRange(camPosX - ACTOR_UPDATE_DIST_BACK, camPosX + ACTOR_UPDATE_DIST_FRONT, actorsActive);
+  ActorStorage::sortByType(actorsActive);
+  activeActorCount = actorsActive.size();
 
-  for(auto & actor : actors) {
-    actor->update(deltaTime);
-    if(actor->drawMask != 0)++drawActorCount;
+  ActorStorage::update(actorsActive, deltaTime);
+  for(auto actor : actorsActive) {
+    actorIndex.update(actor);
   }
 
-  uint32_t actorIdx = 0;
-  for(auto & actor : actors) {
+  // deletion is requested by the actor itself or a collision with it, both only happen close to the camera
+  for(auto actor : actorsActive) {
     if(actor->deleteFlag) {
-      delete actor;
-    } else {
-      actors[actorIdx++] = actor;
+      actorIndex.remove(actor);
+      actorStorage.destroy(actor);
     }
   }
-  actors.resize(actorIdx);
 
   ticksActorUpdate = get_ticks() - ticksActorUpdate;
   collScene.update(deltaTime);
@@ -346,11 +342,7 @@ void Scene::draw(float deltaTime)
   }
 
   t3dState = t3d_model_state_create();
-  for(auto actor : actors) {
-    if(actor->drawMask & Actor::DRAW_MASK_3D) {
-      actor->draw3D(deltaTime);
-    }
-  }
+  ActorStorage::draw3D(*this, actorsDraw3D, deltaTime);
 
   t3d_state_set_vertex_fx(T3D_VERTEX_FX_NONE, 0, 0);
   t3dState.lastVertFXFunc = T3D_VERTEX_FX_NONE;
@@ -371,11 +363,7 @@ void Scene::draw(float deltaTime)
   tpx_state_from_t3d();
   tpx_state_set_scale(0.5f, 0.5f);
 
-  for(auto actor : actors) {
-    if(actor->drawMask & Actor::DRAW_MASK_PTX) {
-      actor->drawPtx(deltaTime);
-    }
-  }
+  ActorStorage::drawPtx(actorsDrawPtx, deltaTime);
 
   rdpq_sync_load();
   ptCoins.draw(deltaTime);
@@ -410,11 +398,7 @@ void Scene::draw(float deltaTime)
   rdpq_mode_filter(FILTER_POINT);
   rdpq_mode_zbuf(false, false);
 
-  for(auto actor : actors) {
-    if(actor->drawMask & Actor::DRAW_MASK_2D) {
-      actor->draw2D(deltaTime);
-    }
-  }
+  ActorStorage::draw2D(actorsDraw2D, deltaTime);
 
   for(auto & player : players) {
     player.draw2D();
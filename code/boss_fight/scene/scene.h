@@ -10,6 +10,9 @@
 #include "player.h"
 #include "../collision/scene.h"
 #include "../collision/navPoints.h"
+#include "level.h"
+#include "actorIndex.h"
+#include "actorStorage.h"
 #include "playerAI.h"
 #include "actors/base.h"
 #include "../render/skybox.h"
@@ -44,6 +47,8 @@ class Scene
     };
 
     CulledModel mapModel;
+    Level::Pack *level{};
+    uint32_t nextSection{0};
     Coll::Mesh *collMesh{};
     Coll::MeshInstance collMeshInstance{.mesh = collMesh};
     Coll::Scene collScene{};
@@ -84,7 +89,14 @@ class Scene
     };
     uint32_t currMostCoins{0};
 
-    std::vector<Actor::Base*> actors{};
+    ActorStorage actorStorage{};
+    ActorIndex actorIndex{};
+    // sorted by type, see 'ActorStorage::sortByType'
+    std::vector<Actor::Base*> actorsActive{};
+    std::vector<Actor::Base*> actorsVisible{};
+    std::vector<Actor::Base*> actorsDraw3D{};
+    std::vector<Actor::Base*> actorsDrawPtx{};
+    std::vector<Actor::Base*> actorsDraw2D{};
 
     std::vector<T3DVec3> respawnPoints{};
     std::vector<ActorSpawnReq> actorSpawnReqs{};
@@ -111,7 +123,8 @@ class Scene
 
     void initCutscenes();
     void changeState(State newState);
-    void loadScene(const char* path);
+    void loadLevel(const char* path);
+    void streamActors();
 
     void overrideInputs(const InputState &inputState) {
       overrideInput = true;
@@ -158,7 +171,8 @@ class Scene
     AudioManager& getAudio() { return audioManager; }
 
     const Player &getPlayer(int index) const { return players[index]; }
-    const std::vector<Actor::Base*>& getActors() const { return actors; }
+    const std::vector<Actor::Base*>& getActiveActors() const { return actorsActive; }
+    [[nodiscard]] uint32_t getActorCount() const { return actorStorage.size(); }
     Camera& getCamera() { return cam; }
 
     const T3DVec3& getClosesRespawn(const T3DVec3 &pos) const;
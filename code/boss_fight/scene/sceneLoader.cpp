@@ -5,39 +5,67 @@
 #include "scene.h"
 
 namespace {
-  struct SceneActor {
-    uint32_t type{};
-    int16_t pos[3]{};
-    uint16_t param{};
-  };
-
-  struct SceneFile {
-    uint32_t actorCount;
-    SceneActor actors[];
-  };
+  // actors are idle until they are 200 units in front of the camera (see 'checkCulling'),
+  // so spawning them a bit before that doesn't change anything
+  constexpr float ACTOR_SPAWN_DIST = 256.0f;
+
+  T3DVec3 getActorPos(const Level::Actor &actor) {
+    return T3DVec3{(float)actor.pos[0], (float)actor.pos[1], (float)actor.pos[2]} * (1.0f / 64.0f);
+  }
 }
 
-void Scene::loadScene(const char* path)
+void Scene::loadLevel(const char* path)
 {
-  SceneFile* scene = (SceneFile*)asset_load(path, nullptr);
-  for(uint32_t i = 0; i < scene->actorCount; i++) {
-    SceneActor* actor = &scene->actors[i];
-    auto pos = T3DVec3{(float)actor->pos[0], (float)actor->pos[1], (float)actor->pos[2]} * (1.0f / 64.0f);
+  level = (Level::Pack*)asset_load(path, nullptr);
+  assertf(memcmp(level->magic, "BFLV", 4) == 0, "Invalid level file: %s", path);
+  assertf(level->version == Level::VERSION, "Invalid level version: %ld != %ld", level->version, Level::VERSION);
+
+  collMesh = Coll::Mesh::fromData(level->getColl());
+  collMeshInstance.mesh = collMesh;
+  collScene.registerMesh(&collMeshInstance);
+
+  navPoints.setPoints(level->getNavPoints(), level->navPointCount);
 
-    switch(actor->type)
+  // index covers all actor sections, converted from file (64 per unit) to render units
+  const Level::Section *sections = level->getSections();
+  if(level->sectionCount > 0) {
+    actorIndex.init(
+      sections[0].minX * (COLL_WORLD_SCALE / 64.0f),
+      sections[level->sectionCount-1].maxX * (COLL_WORLD_SCALE / 64.0f)
+    );
+  } else {
+    actorIndex.init(0.0f, 0.0f);
+  }
+
+  const Level::Actor *actors = level->getActors();
+  for(uint32_t i = 0; i < level->specialCount; i++) {
+    auto pos = getActorPos(actors[i]);
+    switch(actors[i].type)
     {
-      // Special actors
       case "Spwn"_u32:
-        players[actor->param].setPos(pos);
+        players[actors[i].param].setPos(pos);
         camStartPosX = pos.x * COLL_WORLD_SCALE;
       break;
       case "Rset"_u32: respawnPoints.push_back(pos); break;
       case "CEnd"_u32: camEndPosX = pos.x * COLL_WORLD_SCALE; break;
-      case "Guid"_u32: navPoints.addPoint(pos); break;
+    }
+  }
+  nextSection = 0;
+}
+
+void Scene::streamActors()
+{
+  const Level::Section *sections = level->getSections();
+  const Level::Actor *actors = level->getActors();
+  float spawnPosX = cam.getTarget().x + ACTOR_SPAWN_DIST;
+
+  while(nextSection < level->sectionCount) {
+    const auto &section = sections[nextSection];
+    if(section.minX * (COLL_WORLD_SCALE / 64.0f) > spawnPosX)break;
 
-      // Generic actors
-      default: spawnActor(actor->type, pos, actor->param); break;
+    for(uint32_t i = section.firstActor; i < (uint32_t)(section.firstActor + section.actorCount); i++) {
+      spawnActor(actors[i].type, getActorPos(actors[i]), actors[i].param);
     }
+    ++nextSection;
   }
-  free(scene);
-}
\ No newline at end of file
+}
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <cstdio>
+#include <string>
 #include <vector>
 #include <unordered_map>
 #include "bit.h"
@@ -108,6 +109,10 @@ class BinaryFile
       return dataSize;
     }
 
+    const uint8_t* getData() const {
+      return data.data();
+    }
+
     void writeToFile(const char* filename) {
       FILE* file = fopen(filename, "wb");
       fwrite(data.data(), 1, dataSize, file);
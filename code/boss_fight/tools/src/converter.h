@@ -0,0 +1,22 @@
+#pragma once
+
+#include "lib/cgltf.h"
+#include "binaryFile.h"
+
+/**
+ * Parses a glTF file and loads its buffers, throws on invalid files.
+ * The result must be freed with 'cgltf_free'.
+ */
+cgltf_data* loadGltf(const char* gltfPath);
+
+// Collision mesh + BVH of all 'coll_' nodes (.coll)
+BinaryFile convertCollision(const cgltf_data *data);
+
+// Actor placements of all empties tagged as actors (.scene)
+BinaryFile convertScene(const cgltf_data *data);
+
+/**
+ * Level pack (.level) read by the runtime with a single 'asset_load':
+ * actors grouped into X-sections, nav points sorted by X and the collision mesh.
+ */
+BinaryFile convertLevel(const cgltf_data *data);
@@ -0,0 +1,26 @@
+#ifndef N64
+
+#include <stdexcept>
+
+#define CGLTF_IMPLEMENTATION
+#include "converter.h"
+
+cgltf_data* loadGltf(const char* gltfPath)
+{
+  cgltf_options options{};
+  cgltf_data* data = nullptr;
+  cgltf_result result = cgltf_parse_file(&options, gltfPath, &data);
+
+  if(result == cgltf_result_file_not_found) {
+    throw std::runtime_error("File not found!");
+  }
+  if(result != cgltf_result_success || cgltf_validate(data) != cgltf_result_success) {
+    cgltf_free(data);
+    throw std::runtime_error("Invalid glTF data!");
+  }
+
+  cgltf_load_buffers(&options, data, gltfPath);
+  return data;
+}
+
+#endif
@@ -0,0 +1,186 @@
+#ifndef N64
+
+#include "converter.h"
+#include "assetCache.h"
+#include "bvh/v2/thread_pool.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+#include <filesystem>
+
+namespace fs = std::filesystem;
+
+/**
+ * Converts any number of glTF files in one go: each file is parsed once and all
+ * of its outputs are generated in parallel, with unchanged sources served from the cache.
+ *
+ * Usage: gltf_to_assets [--cache=<dir>] [--coll] [--scene] [--level] <file.glb>...
+ * Outputs are written next to their source (map.glb -> map.coll, map.scene, map.level).
+ */
+namespace {
+  using Clock = std::chrono::steady_clock;
+
+  struct OutputType {
+    const char* ext;
+    const char* flag;
+    BinaryFile (*convert)(const cgltf_data *data);
+  };
+
+  constexpr OutputType OUTPUT_TYPES[] = {
+    {".coll",  "--coll",  convertCollision},
+    {".scene", "--scene", convertScene},
+    {".level", "--level", convertLevel},
+  };
+
+  struct OutputJob {
+    const OutputType *type{};
+    fs::path path{};
+    double timeMs{};
+    bool cached{};
+    std::string error{};
+  };
+
+  struct AssetJob {
+    fs::path gltfPath{};
+    uint64_t hash{};
+    double parseTimeMs{};
+    std::string error{};
+    std::vector<OutputJob> outputs{};
+
+    [[nodiscard]] double totalTimeMs() const {
+      double time = parseTimeMs;
+      for(auto &out : outputs)time += out.timeMs;
+      return time;
+    }
+  };
+
+  double msSince(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+  }
+
+  // 'cache' is null if the outputs of this asset can't be cached
+  void convertOutput(OutputJob &out, uint64_t hash, const cgltf_data *data, const AssetCache *cache) {
+    auto start = Clock::now();
+    try {
+      auto file = out.type->convert(data);
+      file.writeToFile(out.path.c_str());
+      if(cache)cache->store(hash, out.type->ext, file.getData(), file.getSize());
+    } catch(const std::exception &e) {
+      out.error = e.what();
+    }
+    out.timeMs = msSince(start);
+  }
+
+  void convertAsset(AssetJob &asset, const AssetCache &cache, bvh::v2::ThreadPool &pool) {
+    // Only .glb files are self-contained, external buffers of a .gltf are not part of the hash
+    bool useCache = cache.isEnabled() && asset.gltfPath.extension() == ".glb";
+    if(useCache) {
+      asset.hash = AssetCache::hashFile(asset.gltfPath);
+    }
+
+    std::vector<OutputJob*> pending{};
+    for(auto &out : asset.outputs) {
+      auto start = Clock::now();
+      out.cached = useCache && cache.fetch(asset.hash, out.type->ext, out.path);
+      out.timeMs = msSince(start);
+      if(!out.cached)pending.push_back(&out);
+    }
+    if(pending.empty())return;
+
+    auto start = Clock::now();
+    std::shared_ptr<cgltf_data> data{};
+    try {
+      data = std::shared_ptr<cgltf_data>{loadGltf(asset.gltfPath.c_str()), cgltf_free};
+    } catch(const std::exception &e) {
+      asset.error = e.what();
+      return;
+    }
+    asset.parseTimeMs = msSince(start);
+
+    // The parsed file is shared by all outputs and freed with the last of them
+    const AssetCache *outCache = useCache ? &cache : nullptr;
+    for(auto out : pending) {
+      pool.push([out, hash = asset.hash, data, outCache](size_t) {
+        convertOutput(*out, hash, data.get(), outCache);
+      });
+    }
+  }
+}
+
+int main(int argc, char** argv)
+{
+  fs::path cacheDir{};
+  std::vector<const OutputType*> types{};
+  std::vector<AssetJob> assets{};
+
+  for(int i=1; i<argc; ++i) {
+    std::string arg{argv[i]};
+    if(arg.starts_with("--cache=")) {
+      cacheDir = arg.substr(strlen("--cache="));
+      continue;
+    }
+    auto type = std::find_if(std::begin(OUTPUT_TYPES), std::end(OUTPUT_TYPES),
+      [&](const OutputType &t) { return arg == t.flag; });
+    if(type != std::end(OUTPUT_TYPES)) {
+      types.push_back(type);
+      continue;
+    }
+    assets.push_back({.gltfPath = arg});
+  }
+
+  if(assets.empty() || types.empty()) {
+    printf("Usage: %s [--cache=<dir>] [--coll] [--scene] [--level] <file.glb>...\n", argv[0]);
+    return 1;
+  }
+
+  for(auto &asset : assets) {
+    for(auto type : types) {
+      auto outPath = asset.gltfPath;
+      outPath.replace_extension(type->ext);
+      asset.outputs.push_back({.type = type, .path = outPath});
+    }
+  }
+
+  AssetCache cache{cacheDir};
+  {
+    bvh::v2::ThreadPool pool{};
+    for(auto &asset : assets) {
+      pool.push([&asset, &cache, &pool](size_t) {
+        convertAsset(asset, cache, pool);
+      });
+    }
+    pool.wait();
+  }
+
+  // Report the slowest assets first
+  std::vector<const AssetJob*> report{};
+  for(auto &asset : assets)report.push_back(&asset);
+  std::stable_sort(report.begin(), report.end(), [](const AssetJob *a, const AssetJob *b) {
+    return a->totalTimeMs() > b->totalTimeMs();
+  });
+
+  int errorCount = 0;
+  for(auto asset : report) {
+    printf("    [ASSET] %s: %.1fms (parse %.1fms)\n",
+      asset->gltfPath.c_str(), asset->totalTimeMs(), asset->parseTimeMs);
+    if(!asset->error.empty()) {
+      fprintf(stderr, "Error: %s: %s\n", asset->gltfPath.c_str(), asset->error.c_str());
+      ++errorCount;
+      continue;
+    }
+    for(auto &out : asset->outputs) {
+      printf("      %-6s %8.1fms%s\n", out.type->ext, out.timeMs, out.cached ? " (cached)" : "");
+      if(!out.error.empty()) {
+        fprintf(stderr, "Error: %s: %s\n", out.path.c_str(), out.error.c_str());
+        ++errorCount;
+      }
+    }
+  }
+  return errorCount == 0 ? 0 : 1;
+}
+
+#endif
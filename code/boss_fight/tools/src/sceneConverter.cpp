@@ -0,0 +1,199 @@
+#ifndef N64
+
+#include "vec.h"
+#include "math/vec3.h"
+#include "math/mat4.h"
+#include "lib/json.hpp"
+
+namespace {
+  constexpr float BASE_SCALE = 64.0f;
+}
+
+#include "cgltfHelper.h"
+#include "converter.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace {
+  struct Actor {
+    uint32_t type{};
+    int16_t pos[3]{};
+    int16_t param{};
+  };
+  static_assert(sizeof(Actor) == 12);
+
+  constexpr uint32_t strToU32(const char* str) {
+    return (str[0] << 24) | (str[1] << 16) | (str[2] << 8) | str[3];
+  }
+
+  constexpr uint32_t LEVEL_VERSION = 1;
+  constexpr int LEVEL_SECTION_WIDTH = 512; // 8 units
+
+  // handled once at load time, never spawned as actors
+  bool isSpecialActor(uint32_t type) {
+    return type == strToU32("Spwn") || type == strToU32("Rset") || type == strToU32("CEnd");
+  }
+
+  void writeActor(BinaryFile &file, const Actor &actor) {
+    file.write<uint32_t>(actor.type);
+    file.writeArray(actor.pos, 3);
+    file.write<int16_t>(actor.param);
+  }
+
+  std::vector<Actor> parseActors(const cgltf_data *data)
+  {
+    std::vector<Actor> res{};
+    for(int i=0; i<data->nodes_count; ++i)
+    {
+      auto node = &data->nodes[i];
+
+      if(!node->mesh && node->extras.data) {
+
+        Actor actor{};
+        if(node->has_translation) {
+          actor.pos[0] = (int16_t)(node->translation[0] * BASE_SCALE);
+          actor.pos[1] = (int16_t)(node->translation[1] * BASE_SCALE);
+          actor.pos[2] = (int16_t)(node->translation[2] * BASE_SCALE);
+        }
+
+        auto actorJson = nlohmann::json::parse(node->extras.data);
+
+        int type = actorJson["ootEmptyType"].get<int>();
+        if(type == 3) { // actor
+          //printf("Data: %s\n", actorJson.dump(2).c_str());
+          auto name = actorJson["ootActorProperty"]["actorIDCustom"].get<std::string>();
+          int param = std::stoi(actorJson["ootActorProperty"]["actorParam"].get<std::string>());
+          actor.type = strToU32(name.c_str());
+          actor.param = (int16_t)param;
+          res.push_back(actor);
+        }
+      }
+    }
+    // sort actors by type
+    std::sort(res.begin(), res.end(), [](const Actor &a, const Actor &b) {
+      return a.type < b.type;
+    });
+
+    return res;
+  }
+}
+
+BinaryFile convertScene(const cgltf_data *data)
+{
+  auto actors = parseActors(data);
+  BinaryFile sceneFile{};
+  sceneFile.write<uint32_t>(actors.size());
+
+  for(const auto &actor : actors) {
+    writeActor(sceneFile, actor);
+  }
+
+  return sceneFile;
+}
+
+BinaryFile convertLevel(const cgltf_data *data)
+{
+  std::vector<Actor> special{};
+  std::vector<Actor> actors{};
+  std::vector<Actor> navPoints{};
+  for(const auto &actor : parseActors(data)) {
+    if(isSpecialActor(actor.type))special.push_back(actor);
+    else if(actor.type == strToU32("Guid"))navPoints.push_back(actor);
+    else actors.push_back(actor);
+  }
+
+  // actors are grouped into sections along X, so the runtime can spawn them as the camera scrolls.
+  // Inside a section they stay sorted by type, then by position.
+  auto sectionIndex = [](const Actor &actor) {
+    return ((int)actor.pos[0] + 0x8000) / LEVEL_SECTION_WIDTH;
+  };
+  std::sort(actors.begin(), actors.end(), [&](const Actor &a, const Actor &b) {
+    int secA = sectionIndex(a);
+    int secB = sectionIndex(b);
+    if(secA != secB)return secA < secB;
+    if(a.type != b.type)return a.type < b.type;
+    return a.pos[0] < b.pos[0];
+  });
+
+  struct Section {
+    int16_t minX{};
+    int16_t maxX{};
+    uint16_t firstActor{};
+    uint16_t actorCount{};
+  };
+  // indices are into the whole actor list, which starts with the special actors
+  std::vector<Section> sections{};
+  int lastSection = -1;
+  for(uint32_t i=0; i<actors.size(); ++i) {
+    int sec = sectionIndex(actors[i]);
+    if(sec != lastSection) {
+      int minX = sec * LEVEL_SECTION_WIDTH - 0x8000;
+      sections.push_back({
+        .minX = (int16_t)minX,
+        .maxX = (int16_t)std::min(minX + LEVEL_SECTION_WIDTH - 1, 0x7FFF),
+        .firstActor = (uint16_t)(special.size() + i),
+      });
+      lastSection = sec;
+    }
+    ++sections.back().actorCount;
+  }
+
+  // nav points are only ever searched by X, store them sorted and already in world units
+  std::sort(navPoints.begin(), navPoints.end(), [](const Actor &a, const Actor &b) {
+    return a.pos[0] < b.pos[0];
+  });
+
+  auto coll = convertCollision(data);
+
+  BinaryFile file{};
+  file.writeChars("BFLV", 4);
+  file.write<uint32_t>(LEVEL_VERSION);
+  file.write<uint32_t>(special.size() + actors.size());
+  file.write<uint32_t>(special.size());
+  file.write<uint32_t>(sections.size());
+  file.write<uint32_t>(navPoints.size());
+
+  uint32_t posOffsets = file.getPos();
+  file.skip(4 * 4); // offsets: actors, sections, nav points, collision
+  std::vector<uint32_t> offsets{};
+
+  // every section starts 16-byte aligned and is used in place by the runtime
+  file.align(16);
+  offsets.push_back(file.getPos());
+  for(const auto &actor : special)writeActor(file, actor);
+  for(const auto &actor : actors)writeActor(file, actor);
+
+  file.align(16);
+  offsets.push_back(file.getPos());
+  for(const auto &section : sections) {
+    file.write(section.minX);
+    file.write(section.maxX);
+    file.write(section.firstActor);
+    file.write(section.actorCount);
+  }
+
+  file.align(16);
+  offsets.push_back(file.getPos());
+  for(const auto &point : navPoints) {
+    file.write((float)point.pos[0] / BASE_SCALE);
+    file.write((float)point.pos[1] / BASE_SCALE);
+    file.write((float)point.pos[2] / BASE_SCALE);
+  }
+
+  file.align(16);
+  offsets.push_back(file.getPos());
+  file.writeMemFile(coll);
+  file.align(16);
+
+  file.setPos(posOffsets);
+  file.writeArray(offsets.data(), offsets.size());
+
+  printf("Level: %d actors (%d special) in %d sections, %d nav points, %d bytes collision\n",
+    (int)(special.size() + actors.size()), (int)special.size(), (int)sections.size(),
+    (int)navPoints.size(), (int)coll.getSize());
+  return file;
+}
+
+#endif
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include <libdragon.h>
 #include "../../core.h"
+#include "../../assetcache.h"
 #include "../../minigame.h"
 #include <stdio.h>
 #include <stdlib.h>
@@ -42,10 +43,10 @@ T3DVec3 camPos;
 T3DVec3 camTarget;
 T3DVec3 lightDirVec;
 
-wav64_t sfx_start;
-wav64_t sfx_countdown;
-wav64_t sfx_stop;
-wav64_t sfx_winner;
+wav64_t* sfx_start;
+wav64_t* sfx_countdown;
+wav64_t* sfx_stop;
+wav64_t* sfx_winner;
 
 xm64player_t music;
 
@@ -263,10 +264,10 @@ void minigame_init(){
 	camPos = (T3DVec3){{0,0,90.0f}};
 	camTarget = (T3DVec3){{0,0,0}};
 
-  	wav64_open(&sfx_start, "rom:/core/Start.wav64");
-  	wav64_open(&sfx_countdown, "rom:/core/Countdown.wav64");
-  	wav64_open(&sfx_stop, "rom:/core/Stop.wav64");
-  	wav64_open(&sfx_winner, "rom:/core/Winner.wav64");
+  	sfx_start = assetcache_get_sound(ASSETCACHE_SFX_START);
+  	sfx_countdown = assetcache_get_sound(ASSETCACHE_SFX_COUNTDOWN);
+  	sfx_stop = assetcache_get_sound(ASSETCACHE_SFX_STOP);
+  	sfx_winner = assetcache_get_sound(ASSETCACHE_SFX_WINNER);
 
 	uint32_t playercount = core_get_playercount();
 
@@ -361,13 +362,13 @@ void minigame_fixedloop(float deltatime){
 		float prevCountDown = countDownTimer;
 		countDownTimer -= deltatime;
     	if ((int)prevCountDown != (int)countDownTimer && countDownTimer >= 0){
-    		wav64_play(&sfx_countdown, 31);
+    		wav64_play(sfx_countdown, 31);
 		}
 	}
 
 	else if(gameTimer > 0.0f){
 		if(!startSoundPlayed){
-    		wav64_play(&sfx_start, 31);
+    		wav64_play(sfx_start, 31);
 			startSoundPlayed = true;
 		}
 		gameTimer -= deltatime;
@@ -440,7 +441,7 @@ void minigame_fixedloop(float deltatime){
 	else{
   		xm64player_stop(&music);
 		if(!endSoundPlayed){
-      		wav64_play(&sfx_stop, 31);
+      		wav64_play(sfx_stop, 31);
 			endSoundPlayed = true;
 		}
 		winShowTimer -= deltatime;
@@ -450,7 +451,7 @@ void minigame_fixedloop(float deltatime){
 		}
 		else if (winShowTimer < 0.0f){
 			if(!winSoundPlayed){
-				wav64_play(&sfx_winner, 31);
+				wav64_play(sfx_winner, 31);
 				winSoundPlayed = true;
 			}
 			winner = 0;
@@ -642,10 +643,10 @@ void minigame_cleanup(){
 	free_uncached(wall.modelMatFP);
 	t3d_model_free(wall.model);
 
-  	wav64_close(&sfx_start);
-  	wav64_close(&sfx_countdown);
-  	wav64_close(&sfx_stop);
-  	wav64_close(&sfx_winner);
+  	assetcache_release_sound(sfx_start);
+  	assetcache_release_sound(sfx_countdown);
+  	assetcache_release_sound(sfx_stop);
+  	assetcache_release_sound(sfx_winner);
 
   	xm64player_stop(&music);
   	xm64player_close(&music);
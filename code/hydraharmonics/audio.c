@@ -1,5 +1,6 @@
 #include "audio.h"
 #include "hydra.h"
+#include "../../assetcache.h"
 
 // SFX channels for fixed audio
 #define AUDIO_SFX_CHANNELS_GULP_START 0
@@ -23,6 +24,7 @@ static const uint32_t channel_pitch[STATE_COUNT] = {
 };
 
 static wav64_t audio_sfx[SFX_COUNT];
+static wav64_t* winner_sfx;
 static wav64_t gulp_sfx[PLAYER_MAX];
 static wav64_t aah_sfx[PLAYER_MAX];
 static wav64_t eww_sfx[PLAYER_MAX];
@@ -37,7 +39,7 @@ void audio_sfx_init(void) {
 	wav64_open(&audio_sfx[SFX_SLIDE_WHISTLE_UP], "rom:/hydraharmonics/slide-whistle-up.wav64");
 	wav64_open(&audio_sfx[SFX_DRUMROLL], "rom:/hydraharmonics/drumroll.wav64");
 	wav64_set_loop(&audio_sfx[SFX_DRUMROLL], true);
-	wav64_open(&audio_sfx[SFX_WINNER], "rom:/core/Winner.wav64");
+	winner_sfx = assetcache_get_sound(ASSETCACHE_SFX_WINNER);
 	for (uint8_t i=0; i<PLAYER_MAX; i++) {
 		wav64_open(&gulp_sfx[i], "rom:/hydraharmonics/gulp.wav64");
 		wav64_open(&aah_sfx[i], "rom:/hydraharmonics/aah.wav64");
@@ -87,7 +89,7 @@ void audio_sfx_play (audio_sfx_t sound) {
 	// Winner
 	} else if (sound == SFX_WINNER) {
 		mixer_ch_stop(AUDIO_SFX_CHANNELS_DRUMROLL_START);
-		wav64_play(&audio_sfx[sound], AUDIO_SFX_CHANNELS_WINNER_START);
+		wav64_play(winner_sfx, AUDIO_SFX_CHANNELS_WINNER_START);
 	// Other SFX (Whistle up/down)
 	} else {
 		if (sound == SFX_SLIDE_WHISTLE_DOWN) {
@@ -127,7 +129,7 @@ void audio_sfx_close (void) {
 	wav64_close(&audio_sfx[SFX_SLIDE_WHISTLE_DOWN]);
 	wav64_close(&audio_sfx[SFX_SLIDE_WHISTLE_UP]);
 	wav64_close(&audio_sfx[SFX_DRUMROLL]);
-	wav64_close(&audio_sfx[SFX_WINNER]);
+	assetcache_release_sound(winner_sfx);
 	wav64_close(&audio_sfx[SFX_AAH_MIN]);
 	for (uint8_t i=0; i<PLAYER_MAX; i++) {
 		wav64_close(&gulp_sfx[i]);
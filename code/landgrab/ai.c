@@ -1,19 +1,114 @@
+#include <limits.h>
+
 #include "ai.h"
 #include "board.h"
+#include "minigame.h"
+
+#define AI_SHOW_STATS 0
+
+// How many of the best moves are kept, in case the first one is refused
+#define AI_CANDIDATES 8
+// How many of the best moves Hard checks against the next player's reply
+#define AI_HARD_REPLIES 4
+// Work done by a search per frame, in candidate placements. Searches that
+// need more carry on over the next frames.
+#define AI_PLACEMENTS_PER_TICK 1000
+
+// Scoring weights
+#define AI_WEIGHT_TERRITORY 10
+#define AI_WEIGHT_CORNERS 2
+#define AI_WEIGHT_BLOCKING 3
+#define AI_WEIGHT_REPLY 1
+#define AI_MEDIUM_NOISE 8
 
 typedef struct
 {
+  size_t piece;
+  const PieceMask *mask;
   int col;
   int row;
+  int score;
 } AiMove;
 
+typedef void (*AiMoveVisitor) (const AiMove *move, void *context);
+
+typedef struct
+{
+  int col;
+  int row;
+} AiAnchor;
+
+typedef struct
+{
+  const BoardBits *bits;
+  PlyNum plynum;
+  uint32_t frontier[BOARD_BITS_ROWS];
+  int frontier_count;
+  uint32_t opponent_frontiers[BOARD_BITS_ROWS];
+  int noise;
+} AiScoring;
+
+typedef struct
+{
+  AiScoring scoring;
+  AiMove *moves;
+  size_t capacity;
+  size_t count;
+} AiBestMoves;
+
+typedef struct
+{
+  AiMove move;
+  size_t seen;
+} AiRandomMove;
+
+/**
+ * A move enumeration that can be stopped between anchors and pieces, and
+ * picked up again on the next frame.
+ */
+typedef struct
+{
+  const BoardBits *bits;
+  PlyNum plynum;
+  bool first_turn;
+  const size_t *pieces;
+  size_t piece_count;
+  AiMoveVisitor visitor;
+  void *context;
+  AiAnchor anchors[BOARD_SIZE];
+  size_t anchor_count;
+  size_t anchor_index;
+  size_t piece_index;
+  uint32_t done[BOARD_BITS_ROWS];
+} AiEnumeration;
+
+typedef enum
+{
+  AI_SEARCH_MOVES,
+  AI_SEARCH_REPLIES,
+  AI_SEARCH_DONE,
+} AiSearchStage;
+
 static Player *ai_player = NULL;
-static AiMove ai_moves[BOARD_SIZE];
+static AiMove ai_moves[AI_CANDIDATES];
 static size_t ai_move_count;
 static size_t ai_move_index;
+static bool ai_searched;
 static size_t ai_pieces[PIECE_COUNT];
 static size_t ai_piece_count;
-static size_t ai_piece_index;
+
+// Search state, kept between frames
+static PlyNum ai_plynum;
+static AiSearchStage ai_stage;
+static AiEnumeration ai_enumeration;
+static AiBestMoves ai_best;
+static const Player *ai_next;
+static size_t ai_reply_index;
+static size_t ai_reply_count;
+static bool ai_reply_started;
+static BoardBits ai_reply_bits;
+static AiMove ai_reply_move;
+static size_t ai_reply_pieces[PIECE_COUNT];
 
 static void
 ai_shuffle_pieces (size_t *array, size_t n)
@@ -62,237 +157,500 @@ ai_shuffle_pieces_easy (void)
     }
 }
 
-/**
- * Shuffle the AI pieces for Medium difficulty.
- *
- * Buckets the pieces into three groups: 5-4, 3-2, and 1.
- * Within each group, the pieces will be randomized;
- * Assumes the pieces are currently sorted by value descending.
- * Slightly stupider than the Hard shuffle, but still competent.
- */
-static void
-ai_shuffle_pieces_medium (void)
+static size_t
+ai_gather_initial_anchors (PlyNum p, AiAnchor *anchors)
 {
-  if (ai_piece_count > 1)
+  size_t index = 0;
+  const AiAnchor corners[] = {
+    { 0, 0 },
+    { BOARD_COLS - 1, 0 },
+    { 0, BOARD_ROWS - 1 },
+    { BOARD_COLS - 1, BOARD_ROWS - 1 },
+  };
+
+  // The player's own corner is tried first
+  for (size_t j = 0; j < ARRAY_SIZE (corners); j++)
     {
-      size_t bucket_start = 0;
-      size_t bucket_size = 0;
-      int bucket_value = PIECES[ai_pieces[0]].value;
-      for (size_t i = 0; i < ai_piece_count; i++)
+      if (j == p && board_is_tile_unclaimed (corners[j].col, corners[j].row))
         {
-          int piece_value = PIECES[ai_pieces[i]].value;
-          if ((piece_value <= 3 && bucket_value > 3)
-              || (piece_value == 1 && bucket_value > 1))
-            {
-              ai_shuffle_pieces (&ai_pieces[bucket_start], bucket_size);
-              bucket_start = i;
-              bucket_size = 0;
-              bucket_value = piece_value;
-            }
-          bucket_size++;
+          anchors[index++] = corners[j];
         }
-      ai_shuffle_pieces (&ai_pieces[bucket_start], bucket_size);
     }
-}
 
-/**
- * Shuffle the AI pieces for Hard difficulty.
- *
- * Randomize the pieces but keep their values in-order.
- * Assumes the pieces are currently sorted by value descending.
- * The optimal game strategy is to use the highest-value pieces first.
- */
-static void
-ai_shuffle_pieces_hard (void)
-{
-  if (ai_piece_count > 1)
+  for (size_t j = 0; j < ARRAY_SIZE (corners); j++)
     {
-      size_t bucket_start = 0;
-      size_t bucket_size = 0;
-      int bucket_value = PIECES[ai_pieces[0]].value;
-      for (size_t i = 0; i < ai_piece_count; i++)
+      if (j != p && board_is_tile_unclaimed (corners[j].col, corners[j].row))
         {
-          int piece_value = PIECES[ai_pieces[i]].value;
-          if (piece_value < bucket_value)
-            {
-              ai_shuffle_pieces (&ai_pieces[bucket_start], bucket_size);
-              bucket_start = i;
-              bucket_size = 0;
-              bucket_value = piece_value;
-            }
-          bucket_size++;
+          anchors[index++] = corners[j];
         }
-      ai_shuffle_pieces (&ai_pieces[bucket_start], bucket_size);
     }
+
+  return index;
 }
 
-static void
-ai_shuffle_moves (void)
+static size_t
+ai_gather_next_anchors (const BoardBits *bits, PlyNum p, AiAnchor *anchors)
 {
-  if (ai_move_count > 1)
+  size_t index = 0;
+  for (int row = 0; row < BOARD_ROWS; row++)
     {
-      for (size_t i = 0; i < ai_move_count; i++)
+      uint32_t tiles = bits->frontier[p][row + 1];
+      while (tiles)
         {
-          size_t j = i + rand () / (RAND_MAX / (ai_move_count - i) + 1);
-          AiMove temp = ai_moves[i];
-          ai_moves[i] = ai_moves[j];
-          ai_moves[j] = temp;
+          int bit = __builtin_ctz (tiles);
+          tiles &= tiles - 1;
+          anchors[index].col = bit - 1;
+          anchors[index].row = row;
+          index++;
         }
     }
+  return index;
 }
 
-static void
-ai_gather_initial_moves (PlyNum p)
+static size_t
+ai_gather_pieces (const Player *player, size_t *pieces)
 {
-  int index = 0;
-  const AiMove corners[] = {
-    { 0, 0 },
-    { BOARD_COLS - 1, 0 },
-    { 0, BOARD_ROWS - 1 },
-    { BOARD_COLS - 1, BOARD_ROWS - 1 },
-  };
-
-  for (size_t j = 0; j < ARRAY_SIZE (corners); j++)
+  size_t count = 0;
+  for (size_t i = 0; i < PIECE_COUNT; i++)
     {
-      if (j == p && board_is_tile_unclaimed (corners[j].col, corners[j].row))
+      if (!player->pieces_used[i])
         {
-          ai_moves[index].col = corners[j].col;
-          ai_moves[index].row = corners[j].row;
-          index++;
+          pieces[count++] = i;
         }
     }
+  return count;
+}
 
-  for (size_t j = 0; j < ARRAY_SIZE (corners); j++)
+static bool
+ai_covers_done_anchor (const uint32_t *done, const AiMove *move)
+{
+  if (move->col < 0 || move->row < 0)
     {
-      if (j != p && board_is_tile_unclaimed (corners[j].col, corners[j].row))
+      return false;
+    }
+  for (int r = 0; r < move->mask->rows && move->row + 1 + r < BOARD_BITS_ROWS;
+       r++)
+    {
+      if ((move->mask->cells[r] << (move->col + 1)) & done[move->row + 1 + r])
         {
-          ai_moves[index].col = corners[j].col;
-          ai_moves[index].row = corners[j].row;
-          index++;
+          return true;
         }
     }
-
-  ai_move_count = index;
+  return false;
 }
 
+/**
+ * Prepare to visit every legal placement of the given pieces.
+ *
+ * Every legal move covers at least one anchor (a board corner on the first
+ * turn, a frontier tile afterwards), so each filled tile of each orientation
+ * is lined up with each anchor in turn. Moves covering an anchor that was
+ * already done are skipped, so each legal move is visited exactly once.
+ */
 static void
-ai_gather_next_moves (PlyNum p)
+ai_enumeration_init (AiEnumeration *enumeration, const BoardBits *bits,
+                     PlyNum p, bool first_turn, const size_t *pieces,
+                     size_t piece_count, AiMoveVisitor visitor, void *context)
+{
+  enumeration->bits = bits;
+  enumeration->plynum = p;
+  enumeration->first_turn = first_turn;
+  enumeration->pieces = pieces;
+  enumeration->piece_count = piece_count;
+  enumeration->visitor = visitor;
+  enumeration->context = context;
+  enumeration->anchor_count
+      = first_turn ? ai_gather_initial_anchors (p, enumeration->anchors)
+                   : ai_gather_next_anchors (bits, p, enumeration->anchors);
+  enumeration->anchor_index = 0;
+  enumeration->piece_index = 0;
+  memset (enumeration->done, 0, sizeof (enumeration->done));
+}
+
+/**
+ * Visit placements until the budget runs out, which is only checked between
+ * pieces: one piece on one anchor tries at most
+ * PIECE_MAX_ORIENTATIONS * PIECE_MAX_VALUE placements.
+ *
+ * Returns true once every legal move has been visited.
+ */
+static bool
+ai_enumeration_step (AiEnumeration *enumeration, int *budget)
 {
-  size_t move_index = 0;
-  for (size_t board_row = 0; board_row < BOARD_ROWS; board_row++)
+  AiMove move = { 0 };
+  while (enumeration->anchor_index < enumeration->anchor_count)
     {
-      for (size_t board_col = 0; board_col < BOARD_COLS; board_col++)
+      const AiAnchor *anchor
+          = &enumeration->anchors[enumeration->anchor_index];
+      while (enumeration->piece_index < enumeration->piece_count)
         {
-          if (board_is_tile_claimed (board_col, board_row, p))
+          if (*budget <= 0)
             {
-              // Is the cell to the top-left of this cell viable?
-              if (board_is_tile_valid (board_col - 1, board_row - 1)
-                  && !board_is_tile_claimed (board_col - 1, board_row, p)
-                  && !board_is_tile_claimed (board_col, board_row - 1, p)
-                  && board_is_tile_unclaimed (board_col - 1, board_row - 1))
-                {
-                  ai_moves[move_index].col = board_col - 1;
-                  ai_moves[move_index].row = board_row - 1;
-                  move_index++;
-                }
-              // Is the cell to the top-right of this cell viable?
-              if (board_is_tile_valid (board_col + 1, board_row - 1)
-                  && !board_is_tile_claimed (board_col + 1, board_row, p)
-                  && !board_is_tile_claimed (board_col, board_row - 1, p)
-                  && board_is_tile_unclaimed (board_col + 1, board_row - 1))
-                {
-                  ai_moves[move_index].col = board_col + 1;
-                  ai_moves[move_index].row = board_row - 1;
-                  move_index++;
-                }
-              // Is the cell to the bottom-left of this cell viable?
-              if (board_is_tile_valid (board_col - 1, board_row + 1)
-                  && !board_is_tile_claimed (board_col - 1, board_row, p)
-                  && !board_is_tile_claimed (board_col, board_row + 1, p)
-                  && board_is_tile_unclaimed (board_col - 1, board_row + 1))
-                {
-                  ai_moves[move_index].col = board_col - 1;
-                  ai_moves[move_index].row = board_row + 1;
-                  move_index++;
-                }
-              // Is the cell to the bottom-right of this cell viable?
-              if (board_is_tile_valid (board_col + 1, board_row + 1)
-                  && !board_is_tile_claimed (board_col + 1, board_row, p)
-                  && !board_is_tile_claimed (board_col, board_row + 1, p)
-                  && board_is_tile_unclaimed (board_col + 1, board_row + 1))
+              return false;
+            }
+          move.piece = enumeration->pieces[enumeration->piece_index++];
+          const PieceOrientations *orientations
+              = piece_get_orientations (move.piece);
+          for (size_t o = 0; o < orientations->count; o++)
+            {
+              move.mask = &orientations->masks[o];
+              for (int r = 0; r < move.mask->rows; r++)
                 {
-                  ai_moves[move_index].col = board_col + 1;
-                  ai_moves[move_index].row = board_row + 1;
-                  move_index++;
+                  uint32_t cells = move.mask->cells[r];
+                  while (cells)
+                    {
+                      int c = __builtin_ctz (cells);
+                      cells &= cells - 1;
+                      move.col = anchor->col - c;
+                      move.row = anchor->row - r;
+                      (*budget)--;
+                      if (!ai_covers_done_anchor (enumeration->done, &move)
+                          && board_bits_check (enumeration->bits,
+                                               enumeration->plynum,
+                                               enumeration->first_turn,
+                                               move.mask, move.col,
+                                               move.row))
+                        {
+                          enumeration->visitor (&move, enumeration->context);
+                        }
+                    }
                 }
             }
         }
+      enumeration->done[anchor->row + 1] |= 1u << (anchor->col + 1);
+      enumeration->piece_index = 0;
+      enumeration->anchor_index++;
+    }
+  return true;
+}
+
+static int
+ai_count_bits (const uint32_t *rows)
+{
+  int count = 0;
+  for (int r = 0; r < BOARD_BITS_ROWS; r++)
+    {
+      count += __builtin_popcount (rows[r]);
     }
-  ai_move_count = move_index;
+  return count;
 }
 
 static void
-ai_gather_pieces (Player *player)
+ai_scoring_init (AiScoring *scoring, const BoardBits *bits, PlyNum p,
+                 int noise)
 {
-  ai_piece_count = 0;
-  for (size_t i = 0; i < PIECE_COUNT; i++)
+  scoring->bits = bits;
+  scoring->plynum = p;
+  scoring->noise = noise;
+  memcpy (scoring->frontier, bits->frontier[p], sizeof (scoring->frontier));
+  scoring->frontier_count = ai_count_bits (scoring->frontier);
+  memset (scoring->opponent_frontiers, 0,
+          sizeof (scoring->opponent_frontiers));
+  PLAYER_FOREACH (q)
+  {
+    if (q != p)
+      {
+        for (int r = 0; r < BOARD_BITS_ROWS; r++)
+          {
+            scoring->opponent_frontiers[r] |= bits->frontier[q][r];
+          }
+      }
+  }
+}
+
+/**
+ * Static evaluation of a move: tiles claimed (territory), diagonal corners
+ * the player can grow from afterwards (corner access) and opponents' corners
+ * taken away (blocking).
+ */
+static int
+ai_score_move (const AiScoring *scoring, const AiMove *move)
+{
+  // Placing the piece only changes the frontier from the row above it to the
+  // row below it, so only those rows are recomputed
+  const BoardBits *bits = scoring->bits;
+  const uint32_t *own = bits->claimed[scoring->plynum];
+  int first = move->row > 0 ? move->row : 1;
+  int last = move->row + move->mask->rows + 1;
+  last = last < BOARD_BITS_ROWS - 1 ? last : BOARD_BITS_ROWS - 2;
+
+  uint32_t placed[BOARD_BITS_ROWS] = { 0 };
+  for (int r = 0; r < move->mask->rows; r++)
     {
-      if (!player->pieces_used[i])
+      placed[move->row + 1 + r] = move->mask->cells[r] << (move->col + 1);
+    }
+
+  int corners = scoring->frontier_count;
+  for (int r = first; r <= last; r++)
+    {
+      uint32_t above = own[r - 1] | placed[r - 1];
+      uint32_t here = own[r] | placed[r];
+      uint32_t below = own[r + 1] | placed[r + 1];
+      uint32_t diagonals
+          = (above << 1) | (above >> 1) | (below << 1) | (below >> 1);
+      uint32_t faces = above | below | (here << 1) | (here >> 1);
+      uint32_t frontier = diagonals & ~faces & ~(bits->occupied[r] | placed[r])
+                          & BOARD_BITS_MASK;
+      corners += __builtin_popcount (frontier)
+                 - __builtin_popcount (scoring->frontier[r]);
+    }
+
+  int blocked = 0;
+  for (int r = 0; r < move->mask->rows; r++)
+    {
+      uint32_t cells = move->mask->cells[r] << (move->col + 1);
+      blocked += __builtin_popcount (
+          cells & scoring->opponent_frontiers[move->row + 1 + r]);
+    }
+
+  int score = AI_WEIGHT_TERRITORY * PIECES[move->piece].value
+              + AI_WEIGHT_CORNERS * corners + AI_WEIGHT_BLOCKING * blocked;
+  if (scoring->noise > 0)
+    {
+      score += rand () % scoring->noise;
+    }
+  return score;
+}
+
+static void
+ai_visit_best (const AiMove *move, void *context)
+{
+  AiBestMoves *best = context;
+  AiMove scored = *move;
+  scored.score = ai_score_move (&best->scoring, move);
+  if (best->count == best->capacity
+      && scored.score <= best->moves[best->count - 1].score)
+    {
+      return;
+    }
+
+  // Insertion into the list, sorted by descending score
+  size_t i = best->count < best->capacity ? best->count++ : best->count - 1;
+  while (i > 0 && best->moves[i - 1].score < scored.score)
+    {
+      best->moves[i] = best->moves[i - 1];
+      i--;
+    }
+  best->moves[i] = scored;
+}
+
+static void
+ai_visit_random (const AiMove *move, void *context)
+{
+  // Reservoir sampling: every legal move has the same odds of being kept
+  AiRandomMove *random = context;
+  random->seen++;
+  if (rand () % random->seen == 0)
+    {
+      random->move = *move;
+    }
+}
+
+/**
+ * Easy: a random legal move of the first piece (in shuffled order) that fits.
+ */
+static void
+ai_search_easy (Player *player, const BoardBits *bits)
+{
+  for (size_t i = 0; i < ai_piece_count; i++)
+    {
+      // Only one piece at a time, so this is never spread over frames
+      AiRandomMove random = { 0 };
+      int budget = INT_MAX;
+      ai_enumeration_init (&ai_enumeration, bits, player->plynum,
+                           player_is_first_turn (player), &ai_pieces[i], 1,
+                           ai_visit_random, &random);
+      ai_enumeration_step (&ai_enumeration, &budget);
+      if (random.seen > 0)
         {
-          ai_pieces[ai_piece_count] = i;
-          ai_piece_count++;
+          ai_moves[0] = random.move;
+          ai_move_count = 1;
+          return;
         }
     }
 }
 
+static void
+ai_search_best_start (const Player *player, const BoardBits *bits,
+                      const size_t *pieces, size_t piece_count, int noise,
+                      AiBestMoves *best, AiMove *moves, size_t capacity)
+{
+  *best = (AiBestMoves){ .moves = moves, .capacity = capacity };
+  ai_scoring_init (&best->scoring, bits, player->plynum, noise);
+  ai_enumeration_init (&ai_enumeration, bits, player->plynum,
+                       player_is_first_turn (player), pieces, piece_count,
+                       ai_visit_best, best);
+}
+
+/**
+ * Start looking for the best reply the next player could make to one of
+ * Hard's moves, only looking at their highest-value pieces to keep the
+ * search short. Returns false if they have no reply to look for.
+ */
 static bool
-ai_try_move (Player *player, const AiMove *loc)
+ai_reply_start (const Player *next, const BoardBits *bits, const AiMove *move)
 {
-  CheckPieceResult check_result;
+  if (next == NULL || next->pieces_left == 0 || player_is_first_turn (next))
+    {
+      return false;
+    }
 
-  // Randomly flip and mirror the piece for variety
-  if (rand () % 2)
+  ai_reply_bits = *bits;
+  board_bits_blit (&ai_reply_bits, ai_plynum, move->mask, move->col,
+                   move->row);
+
+  size_t piece_count = ai_gather_pieces (next, ai_reply_pieces);
+  int highest_value = 0;
+  for (size_t i = 0; i < piece_count; i++)
     {
-      player_flip_piece (player);
+      int value = PIECES[ai_reply_pieces[i]].value;
+      highest_value = value > highest_value ? value : highest_value;
     }
-  if (rand () % 2)
+  size_t kept = 0;
+  for (size_t i = 0; i < piece_count; i++)
     {
-      player_mirror_piece (player);
+      if (PIECES[ai_reply_pieces[i]].value == highest_value)
+        {
+          ai_reply_pieces[kept++] = ai_reply_pieces[i];
+        }
     }
 
-  for (size_t orientation = 0; orientation < 4; orientation++)
+  ai_search_best_start (next, &ai_reply_bits, ai_reply_pieces, kept, 0,
+                        &ai_best, &ai_reply_move, 1);
+  return true;
+}
+
+/**
+ * Hard: the best moves are searched one ply deeper, taking away what the
+ * next player in turn order could score in reply.
+ *
+ * Returns true once every reply has been looked at.
+ */
+static bool
+ai_search_replies (const BoardBits *bits, int *budget)
+{
+  for (; ai_reply_index < ai_reply_count; ai_reply_index++)
     {
-      if (orientation == 1)
+      AiMove *move = &ai_moves[ai_reply_index];
+      if (!ai_reply_started)
         {
-          player_mirror_piece (player);
+          if (!ai_reply_start (ai_next, bits, move))
+            {
+              continue;
+            }
+          ai_reply_started = true;
         }
-      if (orientation == 2)
+      if (!ai_enumeration_step (&ai_enumeration, budget))
         {
-          player_flip_piece (player);
+          return false;
         }
-      if (orientation == 3)
+      if (ai_best.count > 0)
         {
-          player_mirror_piece (player);
+          move->score -= AI_WEIGHT_REPLY * ai_reply_move.score;
         }
+      ai_reply_started = false;
+    }
 
-      for (ssize_t offset_y = -PIECE_ROWS; offset_y <= PIECE_ROWS; offset_y++)
+  // Re-sort the moves that were looked at more closely
+  for (size_t i = 1; i < ai_reply_count; i++)
+    {
+      AiMove move = ai_moves[i];
+      size_t j = i;
+      while (j > 0 && ai_moves[j - 1].score < move.score)
         {
-          for (ssize_t offset_x = -PIECE_COLS; offset_x <= PIECE_COLS;
-               offset_x++)
-            {
-              player_set_cursor (player, loc->col + offset_x,
-                                 loc->row + offset_y);
-              check_result = board_check_piece (player);
-              if (check_result.is_valid)
-                {
-                  player_place_piece (player);
-                  return true;
-                }
-            }
+          ai_moves[j] = ai_moves[j - 1];
+          j--;
         }
+      ai_moves[j] = move;
     }
+  return true;
+}
 
-  return false;
+static void
+ai_search_start (Player *player)
+{
+  const BoardBits *bits = board_get_bits ();
+  AiDiff difficulty = core_get_aidifficulty ();
+  ai_plynum = player->plynum;
+  if (difficulty == DIFF_EASY)
+    {
+      ai_shuffle_pieces_easy ();
+      ai_search_easy (player, bits);
+      ai_stage = AI_SEARCH_DONE;
+      return;
+    }
+
+  ai_search_best_start (player, bits, ai_pieces, ai_piece_count,
+                        difficulty == DIFF_MEDIUM ? AI_MEDIUM_NOISE : 0,
+                        &ai_best, ai_moves, AI_CANDIDATES);
+  ai_stage = AI_SEARCH_MOVES;
+
+  ai_next = NULL;
+  for (int i = 1; i < MAXPLAYERS && ai_next == NULL; i++)
+    {
+      const Player *other = &players[(player->plynum + i) % MAXPLAYERS];
+      if (other->pieces_left > 0)
+        {
+          ai_next = other;
+        }
+    }
+}
+
+/**
+ * Advance the search by at most AI_PLACEMENTS_PER_TICK placements (plus the
+ * rest of the piece being tried). Returns true once it is done.
+ */
+static bool
+ai_search_step (void)
+{
+#if AI_SHOW_STATS
+  uint32_t ticks = get_ticks ();
+#endif
+  const BoardBits *bits = board_get_bits ();
+  int budget = AI_PLACEMENTS_PER_TICK;
+
+  if (ai_stage == AI_SEARCH_MOVES
+      && ai_enumeration_step (&ai_enumeration, &budget))
+    {
+      ai_move_count = ai_best.count;
+      ai_reply_index = 0;
+      ai_reply_count = 0;
+      ai_reply_started = false;
+      if (core_get_aidifficulty () == DIFF_HARD)
+        {
+          ai_reply_count = ai_move_count < AI_HARD_REPLIES ? ai_move_count
+                                                           : AI_HARD_REPLIES;
+        }
+      ai_stage = AI_SEARCH_REPLIES;
+    }
+
+  if (ai_stage == AI_SEARCH_REPLIES && ai_search_replies (bits, &budget))
+    {
+      ai_stage = AI_SEARCH_DONE;
+    }
+
+#if AI_SHOW_STATS
+  debugf ("AI P%d search tick: %lu us, %d placements\n",
+          ai_plynum + 1, (unsigned long)TICKS_TO_US (get_ticks () - ticks),
+          AI_PLACEMENTS_PER_TICK - budget);
+#endif
+  return ai_stage == AI_SEARCH_DONE;
+}
+
+static void
+ai_apply_move (Player *player, const AiMove *move)
+{
+  player_change_piece (player, move->piece);
+  if (move->mask->mirrored)
+    {
+      player_mirror_piece (player);
+    }
+  for (int i = 0; i < move->mask->rotations; i++)
+    {
+      player_flip_piece (player);
+    }
+  player_set_cursor (player, move->col - move->mask->col_offset,
+                     move->row - move->mask->row_offset);
 }
 
 void
@@ -302,42 +660,45 @@ ai_reset (Player *player)
   ai_move_count = 0;
   ai_move_index = 0;
   ai_piece_count = 0;
-  ai_piece_index = 0;
+  ai_searched = false;
   if (player == NULL || player->pieces_left == 0)
     {
       return;
     }
-  else if (player_is_first_turn (player))
-    {
-      ai_gather_initial_moves (player->plynum);
-    }
-  else
-    {
-      ai_gather_next_moves (player->plynum);
-      ai_shuffle_moves ();
-    }
 
-  ai_gather_pieces (player);
+  ai_piece_count = ai_gather_pieces (player, ai_pieces);
+}
 
-  AiDiff difficulty = core_get_aidifficulty ();
-  if (difficulty == DIFF_EASY)
-    {
-      ai_shuffle_pieces_easy ();
-    }
-  else if (difficulty == DIFF_MEDIUM)
+/**
+ * Spend this frame's share of the search, so it can run while the AI is
+ * still waiting to move. Returns true once the search is done.
+ */
+bool
+ai_think (Player *player)
+{
+  assert (ai_player == NULL || ai_player == player);
+
+  if (ai_piece_count == 0)
     {
-      ai_shuffle_pieces_medium ();
+      return true;
     }
-  else if (difficulty == DIFF_HARD)
+
+  if (!ai_searched)
     {
-      ai_shuffle_pieces_hard ();
+      ai_search_start (player);
+      ai_searched = true;
     }
+  return ai_stage == AI_SEARCH_DONE || ai_search_step ();
 }
 
 PlayerTurnResult
 ai_try (Player *player)
 {
-  assert (ai_player == NULL || ai_player == player);
+  if (!ai_think (player))
+    {
+      // Still searching
+      return PLAYER_TURN_CONTINUE;
+    }
 
   if (ai_piece_count == 0)
     {
@@ -345,21 +706,14 @@ ai_try (Player *player)
       return PLAYER_TURN_PASS;
     }
 
-  if (ai_piece_index >= ai_piece_count)
-    {
-      // Out of pieces for this move; try the next move
-      ai_move_index += 1;
-      ai_piece_index = 0;
-    }
-
   if (ai_move_index >= ai_move_count)
     {
       // Out of moves!
       return PLAYER_TURN_PASS;
     }
 
-  player_change_piece (player, ai_pieces[ai_piece_index++]);
-  if (ai_try_move (player, &ai_moves[ai_move_index]))
+  ai_apply_move (player, &ai_moves[ai_move_index++]);
+  if (player_place_piece (player))
     {
       // AI has placed a piece
       return PLAYER_TURN_END;
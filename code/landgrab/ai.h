@@ -5,6 +5,8 @@
 
 void ai_reset (Player *player);
 
+bool ai_think (Player *player);
+
 PlayerTurnResult ai_try (Player *player);
 
 #endif // GAMEJAM2024_LANDGRAB_AI_H
@@ -1,16 +1,21 @@
 #include "board.h"
 #include "color.h"
 
+_Static_assert (BOARD_BITS_PLAYERS == MAXPLAYERS,
+                "Board bits keep one frontier per player");
+
 #define TILE_UNCLAIMED 0
 #define TILE_UNCLAIMED_COLOR RGBA32 (160, 160, 160, 64)
 
 static int board[BOARD_SIZE];
+static BoardBits board_bits;
 static sprite_t *x_sprite = NULL;
 
 void
 board_init (void)
 {
   memset (board, TILE_UNCLAIMED, sizeof (board));
+  memset (&board_bits, 0, sizeof (board_bits));
   x_sprite = sprite_load ("rom:/landgrab/x.ia8.sprite");
 }
 
@@ -77,6 +82,42 @@ board_render_bad_tile_marker (int col, int row)
   rdpq_mode_pop ();
 }
 
+/**
+ * Highlight the tiles the player's next piece can grow from: the free board
+ * corners on their first turn, their frontier afterwards.
+ */
+void
+board_render_frontier (Player *player, color_t color)
+{
+  PlyNum p = player->plynum;
+  if (player_is_first_turn (player))
+    {
+      const int corners[4][2] = { { 0, 0 },
+                                  { BOARD_COLS - 1, 0 },
+                                  { 0, BOARD_ROWS - 1 },
+                                  { BOARD_COLS - 1, BOARD_ROWS - 1 } };
+      for (size_t i = 0; i < 4; i++)
+        {
+          if (board_is_tile_unclaimed (corners[i][0], corners[i][1]))
+            {
+              board_render_tile (corners[i][0], corners[i][1], color);
+            }
+        }
+      return;
+    }
+
+  for (int row = 0; row < BOARD_ROWS; row++)
+    {
+      uint32_t tiles = board_bits.frontier[p][row + 1];
+      while (tiles)
+        {
+          int bit = __builtin_ctz (tiles);
+          tiles &= tiles - 1;
+          board_render_tile (bit - 1, row, color);
+        }
+    }
+}
+
 bool
 board_is_tile_valid (int col, int row)
 {
@@ -135,9 +176,13 @@ board_blit_piece (Player *player)
               int board_col = player->cursor_col + piece_col;
               int board_row = player->cursor_row + piece_row;
               board[board_row * BOARD_COLS + board_col] = p + 1;
+              board_bits.claimed[p][board_row + 1] |= 1u << (board_col + 1);
+              board_bits.occupied[board_row + 1] |= 1u << (board_col + 1);
             }
         }
     }
+  board_bits_update_frontiers (&board_bits, p, player->cursor_row,
+                               player->cursor_row + PIECE_ROWS + 1);
 }
 
 CheckPieceResult
@@ -234,3 +279,9 @@ board_check_piece_bail:
 
   return result;
 }
+
+const BoardBits *
+board_get_bits (void)
+{
+  return &board_bits;
+}
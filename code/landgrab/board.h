@@ -1,6 +1,7 @@
 #ifndef GAMEJAM2024_LANDGRAB_BOARD_H
 #define GAMEJAM2024_LANDGRAB_BOARD_H
 
+#include "boardbits.h"
 #include "global.h"
 #include "player.h"
 
@@ -8,10 +9,7 @@
 #define TILE_SIZE 8
 #define TILE_SPACING 1
 
-// Board sizing constants
-#define BOARD_ROWS 20
-#define BOARD_COLS 20
-#define BOARD_SIZE (BOARD_ROWS * BOARD_COLS)
+// Board sizing constants, the rows and columns are in boardbits.h
 #define BOARD_COLOR RGBA32 (0, 0, 0, 64)
 
 // Positioning constants
@@ -49,6 +47,8 @@ void board_render_tile (int col, int row, color_t color);
 
 void board_render_bad_tile_marker (int col, int row);
 
+void board_render_frontier (Player *player, color_t color);
+
 Rect board_get_tile_rect (int x, int y);
 
 CheckPieceResult board_check_piece (Player *player);
@@ -57,4 +57,6 @@ void board_blit_piece (Player *player);
 
 bool board_place_piece (Player *player);
 
+const BoardBits *board_get_bits (void);
+
 #endif // GAMEJAM2024_LANDGRAB_BOARD_H
@@ -0,0 +1,111 @@
+#include "boardbits.h"
+
+static uint32_t
+board_bits_frontier_row (const BoardBits *bits, int p, int r)
+{
+  const uint32_t *own = bits->claimed[p];
+  uint32_t diagonals = (own[r - 1] << 1) | (own[r - 1] >> 1)
+                       | (own[r + 1] << 1) | (own[r + 1] >> 1);
+  uint32_t faces = own[r - 1] | own[r + 1] | (own[r] << 1) | (own[r] >> 1);
+  return diagonals & ~faces & ~bits->occupied[r] & BOARD_BITS_MASK;
+}
+
+/**
+ * Update the frontiers after player p claimed tiles between padded rows
+ * first_row and last_row: only p's frontier can grow, and only around the
+ * new tiles; everyone else just loses the tiles that are now occupied.
+ */
+void
+board_bits_update_frontiers (BoardBits *bits, int p, int first_row,
+                             int last_row)
+{
+  first_row = first_row < 1 ? 1 : first_row;
+  last_row = last_row > BOARD_BITS_ROWS - 2 ? BOARD_BITS_ROWS - 2 : last_row;
+  for (int r = first_row; r <= last_row; r++)
+    {
+      for (int q = 0; q < BOARD_BITS_PLAYERS; q++)
+        {
+          bits->frontier[q][r]
+              = q == p ? board_bits_frontier_row (bits, p, r)
+                       : bits->frontier[q][r] & ~bits->occupied[r];
+        }
+    }
+}
+
+/**
+ * Same rules as board_check_piece, for a piece mask whose top-left filled
+ * bounds are placed at (col, row). The mask must fit inside the board.
+ */
+bool
+board_bits_check (const BoardBits *bits, int p, bool first_turn,
+                  const PieceMask *mask, int col, int row)
+{
+  if (col < 0 || row < 0 || col + mask->cols > BOARD_COLS
+      || row + mask->rows > BOARD_ROWS)
+    {
+      return false;
+    }
+
+  // Every tile must be unclaimed
+  for (int r = 0; r < mask->rows; r++)
+    {
+      if ((mask->cells[r] << (col + 1)) & bits->occupied[row + 1 + r])
+        {
+          return false;
+        }
+    }
+
+  if (first_turn)
+    {
+      // Convenience check for the first piece placed
+      const uint32_t corners = (1u << 1) | (1u << BOARD_COLS);
+      return (row == 0 && (mask->cells[0] << (col + 1)) & corners)
+             || (row + mask->rows == BOARD_ROWS
+                 && (mask->cells[mask->rows - 1] << (col + 1)) & corners);
+    }
+
+  // Halo row 0 is the board row above the piece
+  const uint32_t *own = &bits->claimed[p][row];
+  bool is_touching_corners = false;
+  for (int r = 0; r < mask->rows + 2; r++)
+    {
+      if ((mask->faces[r] << col) & own[r])
+        {
+          return false;
+        }
+      is_touching_corners
+          = is_touching_corners || ((mask->corners[r] << col) & own[r]);
+    }
+  return is_touching_corners;
+}
+
+void
+board_bits_blit (BoardBits *bits, int p, const PieceMask *mask, int col,
+                 int row)
+{
+  for (int r = 0; r < mask->rows; r++)
+    {
+      uint32_t cells = mask->cells[r] << (col + 1);
+      bits->claimed[p][row + 1 + r] |= cells;
+      bits->occupied[row + 1 + r] |= cells;
+    }
+  board_bits_update_frontiers (bits, p, row, row + mask->rows + 1);
+}
+
+/**
+ * Unclaimed tiles where the player's next piece may go: diagonal to one of
+ * their tiles, without sharing an edge with any of them.
+ *
+ * Full rescan of the board; bits->frontier[p] holds the same tiles.
+ */
+void
+board_bits_frontier (const BoardBits *bits, int p,
+                     uint32_t frontier[BOARD_BITS_ROWS])
+{
+  frontier[0] = 0;
+  frontier[BOARD_BITS_ROWS - 1] = 0;
+  for (int r = 1; r < BOARD_BITS_ROWS - 1; r++)
+    {
+      frontier[r] = board_bits_frontier_row (bits, p, r);
+    }
+}
@@ -0,0 +1,51 @@
+#ifndef GAMEJAM2024_LANDGRAB_BOARDBITS_H
+#define GAMEJAM2024_LANDGRAB_BOARDBITS_H
+
+// Only plain C here, so the frontiers can be tested on the host against a
+// full rescan
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "piece.h"
+
+// Board sizing constants
+#define BOARD_ROWS 20
+#define BOARD_COLS 20
+#define BOARD_SIZE (BOARD_ROWS * BOARD_COLS)
+
+// Same as MAXPLAYERS, which board.c checks
+#define BOARD_BITS_PLAYERS 4
+
+/**
+ * @brief Bitboard form of the board, one bit per tile.
+ *
+ * Rows are padded by one empty tile on every side so that neighbours can be
+ * read with plain shifts: tile (col, row) is bit (col + 1) of row (row + 1).
+ *
+ * The frontier of each player (unclaimed tiles diagonal to their territory
+ * without sharing an edge with it) is kept up to date as pieces are placed.
+ */
+#define BOARD_BITS_ROWS (BOARD_ROWS + 2)
+#define BOARD_BITS_MASK (((1u << BOARD_COLS) - 1) << 1)
+
+typedef struct
+{
+  uint32_t claimed[BOARD_BITS_PLAYERS][BOARD_BITS_ROWS];
+  uint32_t occupied[BOARD_BITS_ROWS];
+  uint32_t frontier[BOARD_BITS_PLAYERS][BOARD_BITS_ROWS];
+} BoardBits;
+
+bool board_bits_check (const BoardBits *bits, int p, bool first_turn,
+                       const PieceMask *mask, int col, int row);
+
+void board_bits_blit (BoardBits *bits, int p, const PieceMask *mask, int col,
+                      int row);
+
+void board_bits_update_frontiers (BoardBits *bits, int p, int first_row,
+                                  int last_row);
+
+void board_bits_frontier (const BoardBits *bits, int p,
+                          uint32_t frontier[BOARD_BITS_ROWS]);
+
+#endif // GAMEJAM2024_LANDGRAB_BOARDBITS_H
@@ -1,6 +1,7 @@
 #include "font.h"
 #include "color.h"
 #include "player.h"
+#include "../../assetcache.h"
 
 rdpq_font_t *font_squarewave;
 rdpq_font_t *font_anita;
@@ -9,7 +10,7 @@ rdpq_font_t *font_bbrick;
 void
 font_init (void)
 {
-  font_squarewave = rdpq_font_load ("rom:/squarewave.font64");
+  font_squarewave = assetcache_get_font(ASSETCACHE_FONT_SQUAREWAVE);
   rdpq_text_register_font (FONT_SQUAREWAVE, font_squarewave);
 
   font_anita = rdpq_font_load ("rom:/landgrab/anita_semi_square.font64");
@@ -46,5 +47,5 @@ font_cleanup (void)
   rdpq_font_free (font_anita);
 
   rdpq_text_unregister_font (FONT_SQUAREWAVE);
-  rdpq_font_free (font_squarewave);
+  assetcache_release_font(font_squarewave);
 }
@@ -1,3 +1,6 @@
+#include <assert.h>
+#include <string.h>
+
 #include "piece.h"
 
 #define X CELL_FILLED
@@ -154,3 +157,153 @@ const Piece PIECES[PIECE_COUNT] = {
          0, 0, 0, 0, 0}},
 };
 // clang-format on
+
+static PieceOrientations piece_orientations[PIECE_COUNT];
+static bool piece_orientations_ready = false;
+
+void
+piece_rotate_cells (Cell *cells)
+{
+  Cell temp[PIECE_SIZE];
+  for (int i = 0; i < PIECE_SIZE; i++)
+    {
+      int col = i % PIECE_COLS;
+      int row = i / PIECE_COLS;
+      int new_col = PIECE_COLS - 1 - row;
+      int new_row = col;
+      temp[new_row * PIECE_COLS + new_col] = cells[i];
+    }
+
+  memcpy (cells, temp, sizeof (temp));
+}
+
+void
+piece_mirror_cells (Cell *cells)
+{
+  Cell temp[PIECE_SIZE];
+  for (int i = 0; i < PIECE_SIZE; i++)
+    {
+      int col = i % PIECE_COLS;
+      int row = i / PIECE_COLS;
+      int new_col = PIECE_COLS - 1 - col;
+      int new_row = row;
+      temp[new_row * PIECE_COLS + new_col] = cells[i];
+    }
+
+  memcpy (cells, temp, sizeof (temp));
+}
+
+static void
+piece_build_mask (PieceMask *mask, const Cell *cells)
+{
+  int col0 = PIECE_COLS, row0 = PIECE_ROWS, col1 = -1, row1 = -1;
+  for (int i = 0; i < PIECE_SIZE; i++)
+    {
+      if (cells[i] == CELL_FILLED)
+        {
+          int col = i % PIECE_COLS;
+          int row = i / PIECE_COLS;
+          col0 = col < col0 ? col : col0;
+          row0 = row < row0 ? row : row0;
+          col1 = col > col1 ? col : col1;
+          row1 = row > row1 ? row : row1;
+        }
+    }
+
+  mask->col_offset = col0;
+  mask->row_offset = row0;
+  mask->cols = col1 - col0 + 1;
+  mask->rows = row1 - row0 + 1;
+  memset (mask->cells, 0, sizeof (mask->cells));
+  for (int row = 0; row < mask->rows; row++)
+    {
+      for (int col = 0; col < mask->cols; col++)
+        {
+          if (cells[(row0 + row) * PIECE_COLS + col0 + col] == CELL_FILLED)
+            {
+              mask->cells[row] |= 1u << col;
+            }
+        }
+    }
+
+  // Same cells, moved by one row and column to line up with the halos
+  uint32_t ext[PIECE_ROWS + 4] = { 0 };
+  for (int row = 0; row < mask->rows; row++)
+    {
+      ext[row + 2] = mask->cells[row] << 1;
+    }
+  for (int row = 0; row < mask->rows + 2; row++)
+    {
+      uint32_t above = ext[row];
+      uint32_t here = ext[row + 1];
+      uint32_t below = ext[row + 2];
+      mask->faces[row]
+          = (above | below | (here << 1) | (here >> 1)) & ~here;
+      mask->corners[row] = ((above << 1) | (above >> 1) | (below << 1)
+                            | (below >> 1))
+                           & ~here & ~mask->faces[row];
+    }
+  for (int row = mask->rows + 2; row < PIECE_ROWS + 2; row++)
+    {
+      mask->faces[row] = 0;
+      mask->corners[row] = 0;
+    }
+}
+
+static bool
+piece_mask_equals (const PieceMask *a, const PieceMask *b)
+{
+  return a->cols == b->cols && a->rows == b->rows
+         && memcmp (a->cells, b->cells, sizeof (a->cells)) == 0;
+}
+
+static void
+piece_init_orientations (void)
+{
+  for (size_t i = 0; i < PIECE_COUNT; i++)
+    {
+      PieceOrientations *orientations = &piece_orientations[i];
+      orientations->count = 0;
+      for (int mirrored = 0; mirrored < 2; mirrored++)
+        {
+          Cell cells[PIECE_SIZE];
+          memcpy (cells, PIECES[i].cells, sizeof (cells));
+          if (mirrored)
+            {
+              piece_mirror_cells (cells);
+            }
+          for (int rotations = 0; rotations < 4; rotations++)
+            {
+              PieceMask *mask = &orientations->masks[orientations->count];
+              piece_build_mask (mask, cells);
+              mask->mirrored = mirrored;
+              mask->rotations = rotations;
+              // Symmetrical pieces have fewer distinct orientations
+              bool duplicate = false;
+              for (size_t j = 0; j < orientations->count; j++)
+                {
+                  duplicate = duplicate
+                              || piece_mask_equals (mask,
+                                                    &orientations->masks[j]);
+                }
+              if (!duplicate)
+                {
+                  orientations->count++;
+                }
+              piece_rotate_cells (cells);
+            }
+        }
+    }
+  piece_orientations_ready = true;
+}
+
+const PieceOrientations *
+piece_get_orientations (size_t piece_index)
+{
+  assert (piece_index < PIECE_COUNT);
+  if (!piece_orientations_ready)
+    {
+      piece_init_orientations ();
+    }
+  return &piece_orientations[piece_index];
+}
@@ -1,7 +1,9 @@
 #ifndef GAMEJAM2024_LANDGRAB_PIECE_H
 #define GAMEJAM2024_LANDGRAB_PIECE_H
 
-#include "global.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 
 #define PIECE_ROWS 5
 #define PIECE_COLS 5
@@ -26,4 +28,41 @@ typedef struct
 
 extern const Piece PIECES[PIECE_COUNT];
 
+// Rotations (4) times mirroring (2)
+#define PIECE_MAX_ORIENTATIONS 8
+
+/**
+ * @brief Bitmask form of one orientation of a piece.
+ *
+ * Rows are trimmed to the filled cells, with bit N of each row standing for
+ * column N. The faces and corners masks are one cell larger on every side
+ * (bit 0 and row 0 are the column and row before the piece) and hold the
+ * tiles sharing an edge with the piece and the tiles only touching it
+ * diagonally, respectively.
+ */
+typedef struct
+{
+  bool mirrored;   // Apply player_mirror_piece first...
+  int rotations;   // ...then player_flip_piece this many times
+  int col_offset;  // First filled column in the piece buffer
+  int row_offset;  // First filled row in the piece buffer
+  int cols;
+  int rows;
+  uint32_t cells[PIECE_ROWS];
+  uint32_t faces[PIECE_ROWS + 2];
+  uint32_t corners[PIECE_ROWS + 2];
+} PieceMask;
+
+typedef struct
+{
+  size_t count;
+  PieceMask masks[PIECE_MAX_ORIENTATIONS];
+} PieceOrientations;
+
+void piece_rotate_cells (Cell *cells);
+
+void piece_mirror_cells (Cell *cells);
+
+const PieceOrientations *piece_get_orientations (size_t piece_index);
+
 #endif
@@ -331,6 +331,8 @@ player_loop_ai (Player *player, bool active, float deltatime)
     {
       if (player->ai_delay < 1.0f)
         {
+          // The search runs while waiting, a little every frame
+          ai_think (player);
           player->ai_delay += deltatime;
           return PLAYER_TURN_CONTINUE;
         }
@@ -353,6 +355,8 @@ player_render_piece (Player *player, bool active)
   Cell *piece = player->piece_buffer;
   color_t draw_color = PLAYER_COLORS[player->plynum];
   color_t hint_color = RGBA32 (0x50, 0x50, 0x50, 0x80);
+  color_t frontier_color = PLAYER_COLORS[player->plynum];
+  frontier_color.a = 0x40;
 
   if (active)
     {
@@ -370,6 +374,11 @@ player_render_piece (Player *player, bool active)
   rdpq_mode_combiner (RDPQ_COMBINER_FLAT);
   rdpq_mode_blender (RDPQ_BLENDER_MULTIPLY);
 
+  if (active)
+    {
+      board_render_frontier (player, frontier_color);
+    }
+
   for (size_t i = 0; i < PIECE_SIZE; i++)
     {
       if (piece[i] == CELL_FILLED)
@@ -597,33 +606,13 @@ player_place_piece (Player *player)
 void
 player_flip_piece (Player *player)
 {
-  int temp[PIECE_SIZE];
-  for (int i = 0; i < PIECE_SIZE; i++)
-    {
-      int col = i % PIECE_COLS;
-      int row = i / PIECE_COLS;
-      int new_col = PIECE_COLS - 1 - row;
-      int new_row = col;
-      temp[new_row * PIECE_COLS + new_col] = player->piece_buffer[i];
-    }
-
-  memcpy (player->piece_buffer, temp, sizeof (player->piece_buffer));
+  piece_rotate_cells (player->piece_buffer);
   player_reconstrain_cursor (player);
 }
 
 void
 player_mirror_piece (Player *player)
 {
-  int temp[PIECE_SIZE];
-  for (int i = 0; i < PIECE_SIZE; i++)
-    {
-      int col = i % PIECE_COLS;
-      int row = i / PIECE_COLS;
-      int new_col = PIECE_COLS - 1 - col;
-      int new_row = row;
-      temp[new_row * PIECE_COLS + new_col] = player->piece_buffer[i];
-    }
-
-  memcpy (player->piece_buffer, temp, sizeof (player->piece_buffer));
+  piece_mirror_cells (player->piece_buffer);
   player_reconstrain_cursor (player);
 }
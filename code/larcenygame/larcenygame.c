@@ -6,6 +6,7 @@ RiPpEr253's entry into the N64Brew 2024 Gamejam
 
 #include <libdragon.h>
 #include "../../core.h"
+#include "../../assetcache.h"
 #include "../../minigame.h"
 #include "larcenygame.h"
 #include "larcenygameAI.h"
@@ -53,7 +54,10 @@ sprite_t* spriteAButton;
 player_data players[MAXPLAYERS];
 effect_data effectPool[MAXPLAYERS];
 objective_data objectives[2];
-collisionobject_data collisionObjects[9];
+collisionobject_data collisionObjects[MAX_COLLISION_OBJECTS];
+
+// collision grid, built once over the bounds of the collision objects
+collisiongrid_data collisionGrid;
 
 // camera variables
 cameraanimation_data cameraIntroKeyframes[10];
@@ -71,9 +75,9 @@ rdpq_font_t* fontDebug;
 rdpq_font_t* fontBillboard;
 
 // Sound globals
-wav64_t sfx_start;
-wav64_t sfx_countdown;
-wav64_t sfx_winner;
+wav64_t* sfx_start;
+wav64_t* sfx_countdown;
+wav64_t* sfx_winner;
 wav64_t sfx_objectiveCompleted;
 wav64_t sfx_guardStunAbility;
 wav64_t sfx_guardStunAbilityHit;
@@ -457,6 +461,28 @@ void HUD_draw()
     //subDrawTime += get_ticks() - subDrawStart;
 }
 
+/*==============================
+    collision_build_grid
+    Builds the collision grid from the collision objects
+    Call again if collision objects are moved or resized
+==============================*/
+
+void collision_build_grid()
+{
+    int numberOfObjects = sizeof(collisionObjects) / sizeof(collisionObjects[0]);
+    collisionbounds_data bounds[MAX_COLLISION_OBJECTS];
+
+    // the bounds use the exact same edges as the checks always have
+    for(int iDx = 0; iDx < numberOfObjects; iDx++)
+    {
+        bounds[iDx].minX = collisionObjects[iDx].collisionCentrePos.v[0] - (collisionObjects[iDx].sizeX / 2);
+        bounds[iDx].maxX = collisionObjects[iDx].collisionCentrePos.v[0] + (collisionObjects[iDx].sizeX / 2);
+        bounds[iDx].minZ = collisionObjects[iDx].collisionCentrePos.v[2] - (collisionObjects[iDx].sizeZ / 2);
+        bounds[iDx].maxZ = collisionObjects[iDx].collisionCentrePos.v[2] + (collisionObjects[iDx].sizeZ / 2);
+    }
+    collision_grid_build(&collisionGrid, bounds, numberOfObjects);
+}
+
 /*==============================
     collision_init
     Initialises collision objects array manually
@@ -563,6 +589,8 @@ void collision_init()
         t3d_model_draw(modelCollision);
         t3d_matrix_pop(1);
     collisionObjects[8].dplCollision = rspq_block_end();
+
+    collision_build_grid();
 }
 
 /*==============================
@@ -605,21 +633,10 @@ void collision_check(collisionresult_data* returnStruct, T3DVec3* pos)
 
     returnStruct->didCollide = false; returnStruct->collisionType = collisionAll; returnStruct->indexOfCollidedObject = 0; returnStruct->intersectionPoint = (T3DVec3){{0}};
 
-    int numberOfObjects = sizeof(collisionObjects) / sizeof(collisionObjects[0]);
-
-    // iterate over every collision box to check
-    for(int iDx = 0; iDx < numberOfObjects; iDx++)
+    int iDx = collision_grid_find(&collisionGrid, pos->v[0], pos->v[2]);
+    if(iDx >= 0)
     {
-        if( pos->v[0] > collisionObjects[iDx].collisionCentrePos.v[0] - (collisionObjects[iDx].sizeX / 2) &&
-            pos->v[0] < collisionObjects[iDx].collisionCentrePos.v[0] + (collisionObjects[iDx].sizeX / 2) &&
-            pos->v[2] > collisionObjects[iDx].collisionCentrePos.v[2] - (collisionObjects[iDx].sizeZ / 2) &&
-            pos->v[2] < collisionObjects[iDx].collisionCentrePos.v[2] + (collisionObjects[iDx].sizeZ / 2))
-        {
-            returnStruct->didCollide = true; returnStruct->collisionType = collisionObjects[iDx].collisionType; returnStruct->indexOfCollidedObject = iDx;
-            // TODO: debug stuff
-            //colTime += get_ticks() - colStart;
-            return;
-        }
+        returnStruct->didCollide = true; returnStruct->collisionType = collisionObjects[iDx].collisionType; returnStruct->indexOfCollidedObject = iDx;
     }
 
     // TODO: debug stuff
@@ -665,70 +682,60 @@ void collision_check_intersect(collisionresult_data* returnStruct, T3DVec3* star
 {
     returnStruct->didCollide = false; returnStruct->collisionType = collisionAll; returnStruct->indexOfCollidedObject = 0; returnStruct->intersectionPoint = (T3DVec3){{0}};
 
-    int numberOfObjects = sizeof(collisionObjects) / sizeof(collisionObjects[0]);
+    int iDx = collision_grid_find(&collisionGrid, endingPos->v[0], endingPos->v[2]);
+    if(iDx < 0) return;
 
-    // iterate over every collision box to check
-    for(int iDx = 0; iDx < numberOfObjects; iDx++)
+    // did collide, now figure out which side
+    // need an escape check by checking for collision again on the modified point?
+    // if starting pos X is lesser outside and ending pos X is inside, then hit on left side
+    if( startingPos->v[0] < collisionObjects[iDx].collisionCentrePos.v[0] - (collisionObjects[iDx].sizeX / 2) &&
+        endingPos->v[0] > collisionObjects[iDx].collisionCentrePos.v[0] - (collisionObjects[iDx].sizeX / 2))
     {
-        if( endingPos->v[0] > collisionObjects[iDx].collisionCentrePos.v[0] - (collisionObjects[iDx].sizeX / 2) &&
-            endingPos->v[0] < collisionObjects[iDx].collisionCentrePos.v[0] + (collisionObjects[iDx].sizeX / 2) &&
-            endingPos->v[2] > collisionObjects[iDx].collisionCentrePos.v[2] - (collisionObjects[iDx].sizeZ / 2) &&
-            endingPos->v[2] < collisionObjects[iDx].collisionCentrePos.v[2] + (collisionObjects[iDx].sizeZ / 2))
-        {
-            // did collide, now figure out which side
-            // need an escape check by checking for collision again on the modified point?
-            // if starting pos X is lesser outside and ending pos X is inside, then hit on left side
-            if( startingPos->v[0] < collisionObjects[iDx].collisionCentrePos.v[0] - (collisionObjects[iDx].sizeX / 2) &&
-                endingPos->v[0] > collisionObjects[iDx].collisionCentrePos.v[0] - (collisionObjects[iDx].sizeX / 2))
-            {
-                // hit the left side
-                // set the X to the box wall, and the Z to the normal end point
-                returnStruct->intersectionPoint.v[0] = startingPos->v[0];
-                returnStruct->intersectionPoint.v[2] = endingPos->v[2];
-            }
-            // if starting pos X is greater and outside and ending pos X is inside, then hit on right side
-            if( startingPos->v[0] > collisionObjects[iDx].collisionCentrePos.v[0] + (collisionObjects[iDx].sizeX / 2) &&
-                endingPos->v[0] < collisionObjects[iDx].collisionCentrePos.v[0] + (collisionObjects[iDx].sizeX / 2))
-            {
-                // hit the right side
-                // set the X to the box wall, and the Z to the normal end point
-                returnStruct->intersectionPoint.v[0] = startingPos->v[0];
-                returnStruct->intersectionPoint.v[2] = endingPos->v[2];
-            }
-            // if starting pos Z is lesser and outside and ending pos X is inside, then hit on right side
-            if( startingPos->v[2] < collisionObjects[iDx].collisionCentrePos.v[2] - (collisionObjects[iDx].sizeZ / 2) &&
-                endingPos->v[2] > collisionObjects[iDx].collisionCentrePos.v[2] - (collisionObjects[iDx].sizeZ / 2))
-            {
-                // hit the top side
-                // set the Z to the box wall, and the X to the normal end point
-                returnStruct->intersectionPoint.v[0] = endingPos->v[0];
-                returnStruct->intersectionPoint.v[2] = startingPos->v[2];
-            }
-            // if starting pos Z is greater and outside and ending pos X is inside, then hit on right side
-            if( startingPos->v[2] > collisionObjects[iDx].collisionCentrePos.v[2] + (collisionObjects[iDx].sizeZ / 2) &&
-                endingPos->v[2] < collisionObjects[iDx].collisionCentrePos.v[2] + (collisionObjects[iDx].sizeZ / 2))
-            {
-                // hit the bottom side
-                // set the Z to the box wall, and the X to the normal end point
-                returnStruct->intersectionPoint.v[0] = endingPos->v[0];
-                returnStruct->intersectionPoint.v[2] = startingPos->v[2];
-            }
-
-            // make sure the intersection point, if any, makes sense
-            if(!(returnStruct->intersectionPoint.v[0] == 0.0f && returnStruct->intersectionPoint.v[2] == 0.0f))
-            {
-                collisionresult_data tempCollisionInfo;
-                collision_check(&tempCollisionInfo, &returnStruct->intersectionPoint);
-                if(tempCollisionInfo.didCollide)
-                {
-                    returnStruct->intersectionPoint = *startingPos;
-                }
-            }
+        // hit the left side
+        // set the X to the box wall, and the Z to the normal end point
+        returnStruct->intersectionPoint.v[0] = startingPos->v[0];
+        returnStruct->intersectionPoint.v[2] = endingPos->v[2];
+    }
+    // if starting pos X is greater and outside and ending pos X is inside, then hit on right side
+    if( startingPos->v[0] > collisionObjects[iDx].collisionCentrePos.v[0] + (collisionObjects[iDx].sizeX / 2) &&
+        endingPos->v[0] < collisionObjects[iDx].collisionCentrePos.v[0] + (collisionObjects[iDx].sizeX / 2))
+    {
+        // hit the right side
+        // set the X to the box wall, and the Z to the normal end point
+        returnStruct->intersectionPoint.v[0] = startingPos->v[0];
+        returnStruct->intersectionPoint.v[2] = endingPos->v[2];
+    }
+    // if starting pos Z is lesser and outside and ending pos X is inside, then hit on right side
+    if( startingPos->v[2] < collisionObjects[iDx].collisionCentrePos.v[2] - (collisionObjects[iDx].sizeZ / 2) &&
+        endingPos->v[2] > collisionObjects[iDx].collisionCentrePos.v[2] - (collisionObjects[iDx].sizeZ / 2))
+    {
+        // hit the top side
+        // set the Z to the box wall, and the X to the normal end point
+        returnStruct->intersectionPoint.v[0] = endingPos->v[0];
+        returnStruct->intersectionPoint.v[2] = startingPos->v[2];
+    }
+    // if starting pos Z is greater and outside and ending pos X is inside, then hit on right side
+    if( startingPos->v[2] > collisionObjects[iDx].collisionCentrePos.v[2] + (collisionObjects[iDx].sizeZ / 2) &&
+        endingPos->v[2] < collisionObjects[iDx].collisionCentrePos.v[2] + (collisionObjects[iDx].sizeZ / 2))
+    {
+        // hit the bottom side
+        // set the Z to the box wall, and the X to the normal end point
+        returnStruct->intersectionPoint.v[0] = endingPos->v[0];
+        returnStruct->intersectionPoint.v[2] = startingPos->v[2];
+    }
 
-            returnStruct->didCollide = true; returnStruct->collisionType = collisionObjects[iDx].collisionType; returnStruct->indexOfCollidedObject = iDx;
-            return;
+    // make sure the intersection point, if any, makes sense
+    if(!(returnStruct->intersectionPoint.v[0] == 0.0f && returnStruct->intersectionPoint.v[2] == 0.0f))
+    {
+        collisionresult_data tempCollisionInfo;
+        collision_check(&tempCollisionInfo, &returnStruct->intersectionPoint);
+        if(tempCollisionInfo.didCollide)
+        {
+            returnStruct->intersectionPoint = *startingPos;
         }
     }
+
+    returnStruct->didCollide = true; returnStruct->collisionType = collisionObjects[iDx].collisionType; returnStruct->indexOfCollidedObject = iDx;
 }
 
 /*==============================
@@ -771,7 +778,7 @@ void end_game(player_team victoriousTeam)
 
     xm64player_stop(&xm_music);
 
-    wav64_play(&sfx_winner, 31);
+    wav64_play(sfx_winner, 31);
     mixer_ch_set_vol(31, 0.75f, 0.75f);
 
     // set off the outro camera animation
@@ -1565,7 +1572,7 @@ void minigame_init()
     rdpq_font_style(fontDebug, 7, &(rdpq_fontstyle_t){ .color = RGBA32(255,255,255,255) });
 
     // load in the player billboard font
-    fontBillboard = rdpq_font_load("rom:/squarewave.font64");
+    fontBillboard = assetcache_get_font(ASSETCACHE_FONT_SQUAREWAVE);
     rdpq_text_register_font(FONT_BILLBOARD, fontBillboard);
     for (size_t i = 0; i < MAXPLAYERS; i++)
     {
@@ -1614,9 +1621,9 @@ void minigame_init()
     syncPoint = 0;
 
     // load sounds
-    wav64_open(&sfx_start, "rom:/core/Start.wav64");
-    wav64_open(&sfx_countdown, "rom:/core/Countdown.wav64");
-    wav64_open(&sfx_winner, "rom:/core/Winner.wav64");
+    sfx_start = assetcache_get_sound(ASSETCACHE_SFX_START);
+    sfx_countdown = assetcache_get_sound(ASSETCACHE_SFX_COUNTDOWN);
+    sfx_winner = assetcache_get_sound(ASSETCACHE_SFX_WINNER);
     
     // TODO: Own sounds
     wav64_open(&sfx_objectiveCompleted, "rom:/larcenygame/objectiveTouch.wav64");
@@ -1685,13 +1692,13 @@ void minigame_fixedloop(float deltaTime)
         if(countdownTimer < lastCountdownNumber)
         {
             lastCountdownNumber = countdownTimer;
-            wav64_play(&sfx_countdown, 31);
+            wav64_play(sfx_countdown, 31);
             mixer_ch_set_vol(31, 0.5f, 0.5f);
         }
 
         if(countdownTimer < 1.0f)
         {
-            wav64_play(&sfx_start, 31);
+            wav64_play(sfx_start, 31);
             mixer_ch_set_vol(31, 0.75f, 0.75f);
             gameStarting = false;
 
@@ -1926,9 +1933,9 @@ void minigame_cleanup()
     // cleanup effects
     effect_cleanup();
 
-    wav64_close(&sfx_start);
-    wav64_close(&sfx_countdown);
-    wav64_close(&sfx_winner);
+    assetcache_release_sound(sfx_start);
+    assetcache_release_sound(sfx_countdown);
+    assetcache_release_sound(sfx_winner);
     wav64_close(&sfx_objectiveCompleted);
     wav64_close(&sfx_guardStunAbility);
     wav64_close(&sfx_guardStunAbilityHit);
@@ -1951,7 +1958,7 @@ void minigame_cleanup()
     free(spriteAButton);
 
     rdpq_text_unregister_font(FONT_BILLBOARD);
-    rdpq_font_free(fontBillboard);
+    assetcache_release_font(fontBillboard);
 
     rdpq_text_unregister_font(FONT_DEBUG);
     rdpq_font_free(fontDebug);
@@ -5,6 +5,7 @@
 #include <t3d/t3dmodel.h>
 #include <t3d/t3dskeleton.h>
 #include <t3d/t3danim.h>
+#include "larcenygameCollision.h"
 
 /*********************************
     Structs for the project
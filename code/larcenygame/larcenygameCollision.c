@@ -0,0 +1,106 @@
+/***************************************************************
+                     larcenygameCollision.c
+
+The collision grid, which lets collision checks test only the
+objects near a position instead of all of them
+***************************************************************/
+
+#include <stddef.h>
+#include "larcenygameCollision.h"
+
+/*==============================
+    collision_grid_index
+    Converts a coordinate to a grid row or column,
+    clamped to the grid
+==============================*/
+
+int collision_grid_index(float coord, float gridMin, float cellSize)
+{
+    int index = (int)((coord - gridMin) / cellSize);
+    if(index < 0) return 0;
+    if(index >= COLLISION_GRID_SIZE) return COLLISION_GRID_SIZE - 1;
+    return index;
+}
+
+/*==============================
+    collision_grid_build
+    Adds every collision object to the grid cells
+    it overlaps, so checks only need to test the objects
+    in the cell of a position instead of all of them
+    Call again if collision objects are moved or resized
+==============================*/
+
+void collision_grid_build(collisiongrid_data* grid, const collisionbounds_data* bounds, int objectCount)
+{
+    grid->objectCount = objectCount;
+    for(int iDx = 0; iDx < objectCount; iDx++)
+    {
+        grid->bounds[iDx] = bounds[iDx];
+        if(iDx == 0 || bounds[iDx].minX < grid->minX) grid->minX = bounds[iDx].minX;
+        if(iDx == 0 || bounds[iDx].maxX > grid->maxX) grid->maxX = bounds[iDx].maxX;
+        if(iDx == 0 || bounds[iDx].minZ < grid->minZ) grid->minZ = bounds[iDx].minZ;
+        if(iDx == 0 || bounds[iDx].maxZ > grid->maxZ) grid->maxZ = bounds[iDx].maxZ;
+    }
+    grid->cellSizeX = (grid->maxX - grid->minX) / COLLISION_GRID_SIZE;
+    grid->cellSizeZ = (grid->maxZ - grid->minZ) / COLLISION_GRID_SIZE;
+
+    for(int z = 0; z < COLLISION_GRID_SIZE; z++)
+        for(int x = 0; x < COLLISION_GRID_SIZE; x++)
+            grid->cells[z][x].objectCount = 0;
+
+    // objects are added in index order, so the first hit in a cell is the same as in the full array
+    for(int iDx = 0; iDx < objectCount; iDx++)
+    {
+        int startX = collision_grid_index(bounds[iDx].minX, grid->minX, grid->cellSizeX);
+        int endX = collision_grid_index(bounds[iDx].maxX, grid->minX, grid->cellSizeX);
+        int startZ = collision_grid_index(bounds[iDx].minZ, grid->minZ, grid->cellSizeZ);
+        int endZ = collision_grid_index(bounds[iDx].maxZ, grid->minZ, grid->cellSizeZ);
+
+        for(int z = startZ; z <= endZ; z++)
+        {
+            for(int x = startX; x <= endX; x++)
+            {
+                collisiongridcell_data* cell = &grid->cells[z][x];
+                cell->objectIndices[cell->objectCount++] = iDx;
+            }
+        }
+    }
+}
+
+/*==============================
+    collision_grid_cell
+    Returns the grid cell of a position, or NULL
+    if it's outside of every collision object
+==============================*/
+
+collisiongridcell_data* collision_grid_cell(collisiongrid_data* grid, float x, float z)
+{
+    // written this way around so NaN positions don't collide either
+    if(!(x > grid->minX && x < grid->maxX && z > grid->minZ && z < grid->maxZ))
+        return NULL;
+
+    return &grid->cells[collision_grid_index(z, grid->minZ, grid->cellSizeZ)]
+                       [collision_grid_index(x, grid->minX, grid->cellSizeX)];
+}
+
+/*==============================
+    collision_grid_find
+    Returns the index of the first collision object
+    a position is inside of, or -1 if there's none
+==============================*/
+
+int collision_grid_find(collisiongrid_data* grid, float x, float z)
+{
+    collisiongridcell_data* cell = collision_grid_cell(grid, x, z);
+    if(cell == NULL) return -1;
+
+    // iterate over the collision boxes in the cell to check
+    for(int iCell = 0; iCell < cell->objectCount; iCell++)
+    {
+        int iDx = cell->objectIndices[iCell];
+        const collisionbounds_data* bounds = &grid->bounds[iDx];
+        if(x > bounds->minX && x < bounds->maxX && z > bounds->minZ && z < bounds->maxZ)
+            return iDx;
+    }
+    return -1;
+}
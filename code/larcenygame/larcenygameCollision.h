@@ -0,0 +1,48 @@
+#ifndef GAMEJAM2024_LARCENYGAMECOLLISION_H
+#define GAMEJAM2024_LARCENYGAMECOLLISION_H
+
+// Only plain C here, so the grid can be tested on the host against a full scan
+
+#define MAX_COLLISION_OBJECTS 9
+#define COLLISION_GRID_SIZE 8
+
+/*********************************
+    Structs for the collision grid
+*********************************/
+
+    // The edges of a collision object, a position collides if it's strictly inside
+    typedef struct
+    {
+        float minX;
+        float maxX;
+        float minZ;
+        float maxZ;
+    } collisionbounds_data;
+
+    // A cell of the collision grid, lists every collision object overlapping it in index order
+    typedef struct
+    {
+        int objectCount;
+        int objectIndices[MAX_COLLISION_OBJECTS];
+    } collisiongridcell_data;
+
+    // The grid, built once over the bounds of the collision objects
+    typedef struct
+    {
+        collisionbounds_data bounds[MAX_COLLISION_OBJECTS];
+        int objectCount;
+        collisiongridcell_data cells[COLLISION_GRID_SIZE][COLLISION_GRID_SIZE];
+        float minX, maxX, minZ, maxZ;
+        float cellSizeX, cellSizeZ;
+    } collisiongrid_data;
+
+/*********************************
+    Functions
+*********************************/
+
+    int collision_grid_index(float coord, float gridMin, float cellSize);
+    void collision_grid_build(collisiongrid_data* grid, const collisionbounds_data* bounds, int objectCount);
+    collisiongridcell_data* collision_grid_cell(collisiongrid_data* grid, float x, float z);
+    int collision_grid_find(collisiongrid_data* grid, float x, float z);
+
+#endif
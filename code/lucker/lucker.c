@@ -1,6 +1,7 @@
 //#include <D:/projects/libdragon/include/libdragon.h>
 #include <libdragon.h>
 #include "../../core.h"
+#include "../../assetcache.h"
 #include "../../minigame.h"
 #include "lucker.h"
 #include "battle.h"
@@ -174,7 +175,7 @@ void minigame_init()
     rdpq_text_register_font(FONT_TEXT, font);
     rdpq_font_style(font, 0, &(rdpq_fontstyle_t){.color = color_from_packed32(TEXT_COLOR) });
 
-    fontBillboard = rdpq_font_load("rom:/squarewave.font64");
+    fontBillboard = assetcache_get_font(ASSETCACHE_FONT_SQUAREWAVE);
     rdpq_text_register_font(FONT_BILLBOARD, fontBillboard);
     for (size_t i = 0; i < MAXPLAYERS; i++)
     {
@@ -703,7 +704,7 @@ void minigame_cleanup()
     sprite_free(LButton);
     sprite_free(RButton);
     rdpq_text_unregister_font(FONT_BILLBOARD);
-    rdpq_font_free(fontBillboard);
+    assetcache_release_font(fontBillboard);
     rdpq_text_unregister_font(FONT_TEXT);
     rdpq_font_free(font);
     t3d_destroy();
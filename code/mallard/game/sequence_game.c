@@ -1,5 +1,6 @@
 #include <libdragon.h>
 #include "../../../core.h"
+#include "../../../assetcache.h"
 #include "../../../minigame.h"
 #include "../mallard.h"
 #include "sequence_game.h"
@@ -58,13 +59,14 @@ xm64player_t sequence_game_xm;
 
 AiDiff difficulty;
 
-wav64_t sfx_start;
-wav64_t sfx_countdown;
-wav64_t sfx_stop;
-wav64_t sfx_winner;
+wav64_t* sfx_start;
+wav64_t* sfx_countdown;
+wav64_t* sfx_stop;
+wav64_t* sfx_winner;
 
 Duck *ducks;
-Snowman *snowmen;
+Snowman snowmen[MAX_SNOWMEN];
+int snowmen_count;
 Controller *controllers;
 
 void sequence_game_init()
@@ -128,10 +130,10 @@ void sequence_game_init()
 
     xm64player_open(&sequence_game_xm, "rom:/mallard/mallard_game_music.xm64");
 
-    wav64_open(&sfx_start, "rom:/core/Start.wav64");
-    wav64_open(&sfx_countdown, "rom:/core/Countdown.wav64");
-    wav64_open(&sfx_stop, "rom:/core/Stop.wav64");
-    wav64_open(&sfx_winner, "rom:/core/Winner.wav64");
+    sfx_start = assetcache_get_sound(ASSETCACHE_SFX_START);
+    sfx_countdown = assetcache_get_sound(ASSETCACHE_SFX_COUNTDOWN);
+    sfx_stop = assetcache_get_sound(ASSETCACHE_SFX_STOP);
+    sfx_winner = assetcache_get_sound(ASSETCACHE_SFX_WINNER);
 
     xm64player_play(&sequence_game_xm, 0);
 }
@@ -182,10 +184,10 @@ void sequence_game_cleanup()
     xm64player_stop(&sequence_game_xm);
     xm64player_close(&sequence_game_xm);
 
-    wav64_close(&sfx_start);
-    wav64_close(&sfx_countdown);
-    wav64_close(&sfx_stop);
-    wav64_close(&sfx_winner);
+    assetcache_release_sound(sfx_start);
+    assetcache_release_sound(sfx_countdown);
+    assetcache_release_sound(sfx_stop);
+    assetcache_release_sound(sfx_winner);
 
     // Close the display and free the allocated memory.
     rspq_wait();
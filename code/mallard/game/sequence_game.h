@@ -58,6 +58,8 @@ typedef struct Duck
     struct Duck *next;
 } Duck;
 
+#define MAX_SNOWMEN 100
+
 typedef enum SnowmanActions
 {
     SNOWMAN_IDLE = 0,
@@ -86,7 +88,6 @@ typedef struct Snowman
     float hit_box_y1;
     float hit_box_x2;
     float hit_box_y2;
-    struct Snowman *next;
 } Snowman;
 
 typedef struct Controller
@@ -26,7 +26,8 @@ extern sprite_t *sequence_game_start_button_sprite;
 extern sprite_t *sequence_game_paused_text_sprite;
 
 extern Duck *ducks;
-extern Snowman *snowmen;
+extern Snowman snowmen[];
+extern int snowmen_count;
 
 extern float time_elapsed;
 extern int winner;
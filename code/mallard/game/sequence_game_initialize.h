@@ -35,7 +35,8 @@
 #define PLAYER_4_SPAWN_Y2 194 - 85 - 1
 
 extern Duck *ducks;
-extern struct Snowman *snowmen;
+extern struct Snowman snowmen[];
+extern int snowmen_count;
 extern struct Controller *controllers;
 
 extern sprite_t *sequence_game_mallard_one_walk_sprite;
@@ -2,7 +2,8 @@
 #define SEQUENCE_GAME_INPUT_H
 #include "../../../core.h"
 
-extern Snowman *snowmen;
+extern Snowman snowmen[];
+extern int snowmen_count;
 extern Duck *ducks;
 
 extern bool sequence_game_should_cleanup;
@@ -12,10 +13,10 @@ extern float sequence_game_start_held_elapsed;
 
 extern AiDiff difficulty;
 extern xm64player_t sequence_game_xm;
-extern wav64_t sfx_start;
-extern wav64_t sfx_countdown;
-extern wav64_t sfx_stop;
-extern wav64_t sfx_winner;
+extern wav64_t* sfx_start;
+extern wav64_t* sfx_countdown;
+extern wav64_t* sfx_stop;
+extern wav64_t* sfx_winner;
 
 typedef struct Vector2
 {
@@ -1,30 +1,25 @@
 #include <libdragon.h>
+#include <string.h>
 #include "sequence_game_initialize.h"
 #include "sequence_game_snowman.h"
 #include "sequence_game_input.h"
 
-#define MAX_SNOWMEN 100
+// Buckets of the screen, to find the nearest snowman without checking all of them.
+#define SNOWMAN_GRID_CELL_SIZE 32
+#define SNOWMAN_GRID_COLUMNS 10
+#define SNOWMAN_GRID_ROWS 8
+
 int snowman_uuid = 0;
 
-int count_snowmen()
-{
-    int count = 0;
-    Snowman *current = snowmen;
-    while (current != NULL)
-    {
-        count++;
-        current = current->next;
-    }
-    return count;
-}
+// Start of each cell in snowmen_grid, which holds indices into snowmen.
+int snowmen_grid_start[SNOWMAN_GRID_COLUMNS * SNOWMAN_GRID_ROWS + 1];
+int snowmen_grid[MAX_SNOWMEN];
 
 void display_snowmen()
 {
-    Snowman *current = snowmen;
-    while (current != NULL)
+    for (int i = 0; i < snowmen_count; i++)
     {
-        fprintf(stderr, "[Snowman #%i - %f], ", current->id, current->collision_box_y2);
-        current = current->next;
+        fprintf(stderr, "[Snowman #%i - %f], ", snowmen[i].id, snowmen[i].collision_box_y2);
     }
     fprintf(stderr, "\n");
 }
@@ -66,9 +61,8 @@ Vector2 get_snowman_spawn()
     }
 }
 
-Snowman *create_snowman()
+void create_snowman(Snowman *snowman)
 {
-    Snowman *snowman = (Snowman *)malloc(sizeof(Snowman));
     Vector2 spawn = get_snowman_spawn();
     snowman->id = snowman_uuid;
     snowman->x = spawn.x;
@@ -90,46 +84,178 @@ Snowman *create_snowman()
     snowman->hit_box_x2 = spawn.x + SNOWMAN_HIT_BOX_X2_OFFSET;
     snowman->hit_box_y2 = spawn.y + SNOWMAN_HIT_BOX_Y2_OFFSET;
     snowman_uuid++;
-    return snowman;
 }
 
 void add_snowman()
 {
-    if (count_snowmen() >= MAX_SNOWMEN)
+    if (snowmen_count >= MAX_SNOWMEN)
     {
         return;
     }
 
-    Snowman *snowman = create_snowman();
+    Snowman snowman;
+    create_snowman(&snowman);
 
-    // Insert at the head if the list is empty.
-    // Insert at the head if the new value is smaller.
-    if (snowmen == NULL || snowmen->y >= snowman->y)
+    // Find the insertion point, before the first snowman that isn't above it.
+    int index = 0;
+    while (index < snowmen_count && snowmen[index].y < snowman.y)
     {
-        snowman->next = snowmen;
-        snowmen = snowman;
-        return;
+        index++;
+    }
+
+    // Insert the new snowman
+    memmove(&snowmen[index + 1], &snowmen[index], (snowmen_count - index) * sizeof(Snowman));
+    snowmen[index] = snowman;
+    snowmen_count++;
+}
+
+void remove_dead_snowmen()
+{
+    // Compact the snowmen, keeping them in order.
+    int count = 0;
+    for (int i = 0; i < snowmen_count; i++)
+    {
+        if (snowmen[i].frames_locked_for_damage == 0 && snowmen[i].health <= 0)
+        {
+            continue;
+        }
+
+        if (count != i)
+        {
+            snowmen[count] = snowmen[i];
+        }
+        count++;
     }
+    snowmen_count = count;
+}
 
-    // Otherwise, Traverse the snowmen to find the correct insertion point.
-    Snowman *current = snowmen;
-    while (current->next != NULL && current->next->y < snowman->y)
+void sort_snowmen()
+{
+    // Insertion sort, snowmen are almost always in order already.
+    for (int i = 1; i < snowmen_count; i++)
     {
-        current = current->next;
+        if (snowmen[i - 1].collision_box_y2 <= snowmen[i].collision_box_y2)
+        {
+            continue;
+        }
+
+        Snowman snowman = snowmen[i];
+        int j = i;
+        while (j > 0 && snowmen[j - 1].collision_box_y2 > snowman.collision_box_y2)
+        {
+            snowmen[j] = snowmen[j - 1];
+            j--;
+        }
+        snowmen[j] = snowman;
     }
+}
 
-    // Insert the new snowman
-    snowman->next = current->next;
-    current->next = snowman;
+int get_snowman_grid_column(float x)
+{
+    int column = (int)(x / SNOWMAN_GRID_CELL_SIZE);
+    return column < 0 ? 0 : column >= SNOWMAN_GRID_COLUMNS ? SNOWMAN_GRID_COLUMNS - 1 : column;
 }
 
-void free_snowmen()
+int get_snowman_grid_row(float y)
+{
+    int row = (int)(y / SNOWMAN_GRID_CELL_SIZE);
+    return row < 0 ? 0 : row >= SNOWMAN_GRID_ROWS ? SNOWMAN_GRID_ROWS - 1 : row;
+}
+
+int get_snowman_grid_cell(Snowman *snowman)
 {
-    Snowman *temporary;
-    while (snowmen != NULL)
+    float snowman_x = (snowman->hit_box_x1 + snowman->hit_box_x2) / 2;
+    float snowman_y = (snowman->hit_box_y1 + snowman->hit_box_y2) / 2;
+    return get_snowman_grid_row(snowman_y) * SNOWMAN_GRID_COLUMNS + get_snowman_grid_column(snowman_x);
+}
+
+void build_snowmen_grid()
+{
+    // Count the snowmen in every cell, then place them in order.
+    int cells = SNOWMAN_GRID_COLUMNS * SNOWMAN_GRID_ROWS;
+    for (int i = 0; i <= cells; i++)
+    {
+        snowmen_grid_start[i] = 0;
+    }
+    for (int i = 0; i < snowmen_count; i++)
+    {
+        snowmen_grid_start[get_snowman_grid_cell(&snowmen[i]) + 1]++;
+    }
+    for (int i = 0; i < cells; i++)
+    {
+        snowmen_grid_start[i + 1] += snowmen_grid_start[i];
+    }
+
+    int filled[SNOWMAN_GRID_COLUMNS * SNOWMAN_GRID_ROWS] = {0};
+    for (int i = 0; i < snowmen_count; i++)
     {
-        temporary = snowmen;
-        snowmen = snowmen->next;
-        free(temporary);
+        int cell = get_snowman_grid_cell(&snowmen[i]);
+        snowmen_grid[snowmen_grid_start[cell] + filled[cell]++] = i;
+    }
+}
+
+Snowman *find_nearest_snowman_to(float x, float y)
+{
+    int nearestIndex = -1;
+    float nearestDistance = 999999.0f;
+
+    int column = get_snowman_grid_column(x);
+    int row = get_snowman_grid_row(y);
+    int rings = SNOWMAN_GRID_COLUMNS > SNOWMAN_GRID_ROWS ? SNOWMAN_GRID_COLUMNS : SNOWMAN_GRID_ROWS;
+
+    // Search the cells around the point, ring by ring.
+    for (int ring = 0; ring < rings; ring++)
+    {
+        // Every snowman further out is at least this far away.
+        if (nearestIndex >= 0 && nearestDistance < (ring - 1) * SNOWMAN_GRID_CELL_SIZE)
+        {
+            break;
+        }
+
+        for (int cellY = row - ring; cellY <= row + ring; cellY++)
+        {
+            if (cellY < 0 || cellY >= SNOWMAN_GRID_ROWS)
+            {
+                continue;
+            }
+
+            for (int cellX = column - ring; cellX <= column + ring; cellX++)
+            {
+                if (cellX < 0 || cellX >= SNOWMAN_GRID_COLUMNS)
+                {
+                    continue;
+                }
+
+                // Only the edge of the ring, the inside was already searched.
+                if (cellY != row - ring && cellY != row + ring && cellX != column - ring && cellX != column + ring)
+                {
+                    continue;
+                }
+
+                int cell = cellY * SNOWMAN_GRID_COLUMNS + cellX;
+                for (int i = snowmen_grid_start[cell]; i < snowmen_grid_start[cell + 1]; i++)
+                {
+                    Snowman *currentSnowman = &snowmen[snowmen_grid[i]];
+                    float snowman_x = (currentSnowman->hit_box_x1 + currentSnowman->hit_box_x2) / 2;
+                    float snowman_y = (currentSnowman->hit_box_y1 + currentSnowman->hit_box_y2) / 2;
+                    float distance = fmax(abs(x - snowman_x), abs(y - snowman_y));
+
+                    // Ties go to the first snowman in draw order, like a full scan.
+                    if (distance < nearestDistance || (distance == nearestDistance && snowmen_grid[i] < nearestIndex))
+                    {
+                        nearestDistance = distance;
+                        nearestIndex = snowmen_grid[i];
+                    }
+                }
+            }
+        }
     }
-}
\ No newline at end of file
+
+    return nearestIndex >= 0 ? &snowmen[nearestIndex] : NULL;
+}
+
+void free_snowmen()
+{
+    snowmen_count = 0;
+    build_snowmen_grid();
+}
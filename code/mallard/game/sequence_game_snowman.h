@@ -20,10 +20,15 @@ extern sprite_t *sequence_game_snowman_idle_sprite;
 extern sprite_t *sequence_game_snowman_damage_sprite;
 extern sprite_t *sequence_game_snowman_jump_sprite;
 
-extern Snowman *snowmen;
+extern Snowman snowmen[];
+extern int snowmen_count;
 extern Duck *ducks;
 
 void add_snowman();
+void remove_dead_snowmen();
+void sort_snowmen();
+void build_snowmen_grid();
+Snowman *find_nearest_snowman_to(float x, float y);
 void free_snowmen();
 void display_snowmen();
 
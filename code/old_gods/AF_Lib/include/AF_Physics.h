@@ -174,7 +174,10 @@ static inline void AF_Physics_IntegrateVelocity(AF_CTransform3D* _transform, AF_
 	Vec3 linearVelocity = _rigidbody->velocity;
 	Vec3 linearDT = Vec3_MULT_SCALAR(linearVelocity, _dt);
 	position = Vec3_ADD(position, linearDT);
-	_transform->pos = position;
+	if(Vec3_EQUAL(position, _transform->pos) == FALSE){
+		_transform->pos = position;
+		_transform->isDirty = TRUE;
+	}
 
 	// LinearDamping
 	linearVelocity = Vec3_MULT_SCALAR(linearVelocity, frameDamping);
@@ -609,130 +612,166 @@ static inline void AF_Physics_ResolveCollision(AF_Entity* _entityA, AF_Entity* _
 
 
 
+/*
+====================
+AF_PHYSICS_SWEEP
+Sort and sweep broadphase state, kept between frames.
+The order is re-sorted every frame, as entities barely move between two frames
+the insertion sort only does a few swaps.
+====================
+*/
+static uint16_t af_physicsSweepOrder[AF_ECS_TOTAL_ENTITIES];
+static int af_physicsSweepCount = 0;
+static float af_physicsSweepMin[AF_ECS_TOTAL_ENTITIES];
+static float af_physicsSweepMax[AF_ECS_TOTAL_ENTITIES];
+static BOOL af_physicsSweepActive[AF_ECS_TOTAL_ENTITIES];
+
+// The narrow phase compares using abs(), which truncates to int, so boxes up to
+// one unit further apart than their bounds still collide. Pad the sweep bounds to match.
+#define AF_PHYSICS_SWEEP_PADDING 0.5f
+
+/*
+====================
+AF_Physics_AABB_TestPair
+Narrow phase test of one pair of colliders, resolves the collision and calls both callbacks if they overlap
+====================
+*/
+static inline BOOL AF_Physics_AABB_TestPair(AF_ECS* _ecs, int _i, int _x){
+	AF_Entity* entity1 = &_ecs->entities[_i];
+	AF_Entity* entity2 = &_ecs->entities[_x];
+	AF_CCollider* collider1 = entity1->collider;
+	AF_CCollider* collider2 = entity2->collider;
+
+	Vec3* posA = &_ecs->transforms[_i].pos;
+	Vec3* posB = &_ecs->transforms[_x].pos;
+	Vec3 halfSizeA = Vec3_MULT_SCALAR(collider1->boundingVolume, .5f);
+	Vec3 halfSizeB = Vec3_MULT_SCALAR(collider2->boundingVolume, .5f);
+
+	Vec3 delta = Vec3_MINUS(*posA, *posB);
+	Vec3 totalSize = Vec3_ADD(halfSizeA, halfSizeB);
+
+	if(!(abs(delta.x) < totalSize.x &&
+		abs(delta.y) < totalSize.y &&
+		abs(delta.z) < totalSize.z)){
+		return FALSE;
+	}
+
+	// Resolve collision
+	//AF_PHYSICS_CUBE_COLLISION_FACES
+	// Get the min and max of each cube
+	Vec3 maxA = Vec3_ADD(collider1->pos, collider1->boundingVolume);
+	Vec3 minA = Vec3_MINUS(collider1->pos, collider1->boundingVolume);
+
+	Vec3 maxB = Vec3_ADD(collider2->pos, collider2->boundingVolume);
+	Vec3 minB = Vec3_MINUS(collider2->pos, collider2->boundingVolume);
+
+	int facesCount = 6;
+	float distances [facesCount];
+
+		 distances[0] = maxB.x - minA.x; // distance of box ’b ’ to ’ left ’ of ’a ’.
+		 distances[1] = maxA.x - minB.x; // distance of box ’b ’ to ’ right ’ of ’a ’.
+		 distances[2] = maxB.y - minA.y; // distance of box ’b ’ to ’ bottom ’ of ’a ’.
+		 distances[3] = maxA.y - minB.y; // distance of box ’b ’ to ’ top ’ of ’a ’.
+		 distances[4] = maxB.z - minA.z; // distance of box ’b ’ to ’ far ’ of ’a ’.
+		 distances[5] = maxA.z - minB.z;  // distance of box ’b ’ to ’ near ’ of ’a ’.
+
+	//TODO: where is __FLT_MAX__ defined? may not be portable
+	float penetration = __FLT_MAX__;
+	Vec3 bestAxis = {0,0,0};	// default value
+	for(int j = 0; j < facesCount; ++j){
+		if(distances[j] < penetration){
+			penetration = distances[j];
+			bestAxis = AF_PHYSICS_CUBE_COLLISION_FACES[j];
+		}
+	}
+
+	// create a new collision struct, seen from each side of the pair
+	AF_Collision collision1 = {TRUE, entity1, entity2, collider1->collision.callback, {0,0,0}, 0.0f, bestAxis, penetration};
+	AF_Collision collision2 = {TRUE, entity2, entity1, collider2->collision.callback, {0,0,0}, 0.0f, Vec3_MULT_SCALAR(bestAxis, -1), penetration};
+
+	// copy the new struct values to each collider
+	collider1->collision = collision1;
+	collider2->collision = collision2;
+
+	// TODO: move this outside the core rendering loop
+	collider1->collision.callback(&collider1->collision);
+	collider2->collision.callback(&collider2->collision);
+
+	// don't apply force for kinematic objects
+	if(entity1->rigidbody->isKinematic == FALSE){
+		AF_Physics_ResolveCollision(entity1, entity2, &collision1);
+	}
+	if(entity2->rigidbody->isKinematic == FALSE){
+		AF_Physics_ResolveCollision(entity2, entity1, &collision2);
+	}
+	return TRUE;
+}
+
 /*
 ====================
 AF_PHYSICS_AABB_Test
-Calculate ray intersection hit test
+Test all colliders against each other.
+Colliders are sorted by the start of their bounds on the x axis, each one is then only
+tested against the following ones until their bounds start past its end.
+Every pair is tested once, entities without a collider are skipped before the sweep.
 ====================
 */
 static inline BOOL AF_Physics_AABB_Test(AF_ECS* _ecs){
-	// TODO:
-	// implement cheaper nested for loop
-	/*
-	https://research.ncl.ac.uk/game/mastersdegree/gametechnologies/physicstutorials/4collisiondetection/Physics%20-%20Collision%20Detection.pdf
-	for int x = 0; x < lastObject ; ++ x {
-		for int y = x +1; y < lastObject ; ++ y ) {
-			if ( IsColliding (x , y )) {
-				ResolveCollision (x , y )
-			}
+	BOOL returnValue = FALSE;
+	int entitiesCount = _ecs->entitiesCount;
+
+	// entities were added or removed, start over from the entity order
+	if(af_physicsSweepCount != entitiesCount){
+		for(int i = 0; i < entitiesCount; ++i){
+			af_physicsSweepOrder[i] = i;
 		}
+		af_physicsSweepCount = entitiesCount;
 	}
-	*/
-	BOOL returnValue = FALSE;
-	for(int i = 0; i < _ecs->entitiesCount; ++i){
 
-		if(AF_Component_GetEnabled(_ecs->colliders[i].enabled == FALSE)){
+	for(int i = 0; i < entitiesCount; ++i){
+		AF_CCollider* collider = &_ecs->colliders[i];
+		float halfSize = collider->boundingVolume.x * .5f + AF_PHYSICS_SWEEP_PADDING;
+		af_physicsSweepMin[i] = _ecs->transforms[i].pos.x - halfSize;
+		af_physicsSweepMax[i] = _ecs->transforms[i].pos.x + halfSize;
+		af_physicsSweepActive[i] = AF_Component_GetHas(collider->enabled);
+	}
+
+	// insertion sort by the start of the bounds
+	for(int i = 1; i < entitiesCount; ++i){
+		uint16_t entity = af_physicsSweepOrder[i];
+		float min = af_physicsSweepMin[entity];
+		int j = i - 1;
+		while(j >= 0 && af_physicsSweepMin[af_physicsSweepOrder[j]] > min){
+			af_physicsSweepOrder[j + 1] = af_physicsSweepOrder[j];
+			--j;
+		}
+		af_physicsSweepOrder[j + 1] = entity;
+	}
+
+	for(int a = 0; a < entitiesCount; ++a){
+		int i = af_physicsSweepOrder[a];
+		if(af_physicsSweepActive[i] == FALSE){
 			continue;
 		}
-		AF_Entity* entity1 = &_ecs->entities[i];
-		AF_CCollider* collider1 = entity1->collider;
-		
-		
-		// rayIntersectionTest everything
-		for(int x = 0; x < _ecs->entitiesCount; ++x){
-			if(AF_Component_GetEnabled(_ecs->colliders[x].enabled == FALSE)){
-				continue;
-			}
 
-			// check self
-			if(i == x){
+		float max = af_physicsSweepMax[i];
+		for(int b = a + 1; b < entitiesCount; ++b){
+			int x = af_physicsSweepOrder[b];
+			// everything after this starts past the end of 'i'
+			if(af_physicsSweepMin[x] >= max){
+				break;
+			}
+			if(af_physicsSweepActive[x] == FALSE){
 				continue;
 			}
 
-			AF_Entity* entity2 = &_ecs->entities[x];
-			AF_CCollider* collider2 = entity2->collider;
-		
-
-			Vec3* posA = &_ecs->transforms[i].pos;
-			Vec3* posB = &_ecs->transforms[x].pos;
-			Vec3 halfSizeA = Vec3_MULT_SCALAR(collider1->boundingVolume, .5f);
-			Vec3 halfSizeB = Vec3_MULT_SCALAR(collider2->boundingVolume, .5f);
-			//Vec3 halfSizeA = Vec3_DIV_SCALAR(collider1->boundingVolume, 2);
-			//Vec3 halfSizeB = Vec3_DIV_SCALAR(collider2->boundingVolume, 2);
-
-			//Vec3 scaledHalfSizeA = Vec3_MULT(halfSizeA, transform1->scale);
-			//Vec3 scaledHalfSizeB = Vec3_MULT(halfSizeB, transform2->scale);
-
-
-			Vec3 delta = Vec3_MINUS(*posA, *posB);
-			Vec3 totalSize = Vec3_ADD(halfSizeA, halfSizeB);
-			//Vec3 totalSize = Vec3_ADD(scaledHalfSizeA, scaledHalfSizeB);
-
-			if(
-				abs(delta.x) < totalSize.x  &&
-				abs(delta.y) < totalSize.y && 
-				abs(delta.z) < totalSize.z){
-
-					// TODO: determine from what direction the collision occurs
-					//ResolveCollision(_ecs, i, x);
-					returnValue = TRUE;
-					// Resolve collision
-					//AF_PHYSICS_CUBE_COLLISION_FACES
-					// Get the min and max of each cube
-					Vec3 maxA = Vec3_ADD(collider1->pos, collider1->boundingVolume);
-					Vec3 minA = Vec3_MINUS(collider1->pos, collider1->boundingVolume);
-
-					Vec3 maxB = Vec3_ADD(collider2->pos, collider2->boundingVolume);
-					Vec3 minB = Vec3_MINUS(collider2->pos, collider2->boundingVolume);
-
-					int facesCount = 6;
-					float distances [facesCount];
-					
-						 distances[0] = maxB.x - minA.x; // distance of box ’b ’ to ’ left ’ of ’a ’.
-						 distances[1] = maxA.x - minB.x; // distance of box ’b ’ to ’ right ’ of ’a ’.
-						 distances[2] = maxB.y - minA.y; // distance of box ’b ’ to ’ bottom ’ of ’a ’.
-						 distances[3] = maxA.y - minB.y; // distance of box ’b ’ to ’ top ’ of ’a ’.
-						 distances[4] = maxB.z - minA.z; // distance of box ’b ’ to ’ far ’ of ’a ’.
-						 distances[5] = maxA.z - minB.z;  // distance of box ’b ’ to ’ near ’ of ’a ’.
-					
-					//TODO: where is __FLT_MAX__ defined? may not be portable
-					float penetration = __FLT_MAX__;
-					Vec3 bestAxis = {0,0,0};	// default value
-					for(int j = 0; j < facesCount; ++j){
-						if(distances[j] < penetration){
-							penetration = distances[j];
-							bestAxis = AF_PHYSICS_CUBE_COLLISION_FACES[j]; 
-						}
-					}
-
-					// create a new collision struct
-					AF_Collision collision1 = {returnValue, entity1, entity2, collider1->collision.callback, {0,0,0}, 0.0f, bestAxis, penetration}; 
-					// TODO: i think the bestAxis should be inverted for the second object
-					AF_Collision collision2 = {returnValue, entity2, entity1, collider2->collision.callback, {0,0,0}, 0.0f, Vec3_MULT_SCALAR(bestAxis, -1), penetration}; 
-					
-					// copy the new struct values to each collider
-					collider1->collision = collision1;
-					collider2->collision = collision2;
-
-					// TODO: move this outside the core rendering loop
-					collider1->collision.callback(&collider1->collision);
-					collider2->collision.callback(&collider2->collision);
-
-					// Apply collision resolution
-					//AF_CTransform3D* transform1 = &_ecs->transforms[i];
-					//AF_CTransform3D* transform2 = &_ecs->transforms[x];
-
-					//AF_C3DRigidbody* rigidbody1 = &_ecs->rigidbodies[i];
-					//AF_C3DRigidbody* rigidbody2 = &_ecs->rigidbodies[x];
-					// don't apply force for kinematic objects
-					if(_ecs->entities[i].rigidbody->isKinematic){
-						continue;
-					}
-					AF_Physics_ResolveCollision(entity1, entity2, &collision1);
+			// test in entity order, so the result doesn't depend on the sort order
+			if(AF_Physics_AABB_TestPair(_ecs, i < x ? i : x, i < x ? x : i) == TRUE){
+				returnValue = TRUE;
 			}
 		}
 	}
-		
+
 	return returnValue;
 }
 
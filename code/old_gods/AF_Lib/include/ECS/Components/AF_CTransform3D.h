@@ -29,6 +29,7 @@ basic struct for the transform component
 // Size is 64 bytes
 typedef struct {
     PACKED_CHAR enabled;
+    PACKED_CHAR isDirty;    // set when pos/rot/scale changed, cleared once the render matrix is rebuilt
     //BOOL has;// = FALSE;
     //BOOL enabled;// = FALSE;
     Vec3 pos;// = {0.0f, 0.0f, 0.0f};
@@ -50,6 +51,7 @@ static inline AF_CTransform3D AF_CTransform3D_ZERO(void){
 	AF_CTransform3D returnTransform = {
         //.has = FALSE,
         .enabled = FALSE,
+        .isDirty = TRUE,
         .pos = {0, 0, 0},
         .localPos = {0, 0, 0},
         .rot = {0, 0, 0},
@@ -72,6 +74,7 @@ static inline AF_CTransform3D AF_CTransform3D_ADD(void){
 	AF_CTransform3D returnTransform = {
         //.has = TRUE,
         .enabled = TRUE,
+        .isDirty = TRUE,
         .pos = {0, 0, 0},
         .localPos = {0, 0, 0},
         .rot = {0, 0, 0},
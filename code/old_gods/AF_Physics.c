@@ -57,9 +57,16 @@ void AF_Physics_Update(AF_ECS* _ecs, const float _dt){
 	AF_CTransform3D* parentTransform =_ecs->entities[i].parentTransform;
 	// make sure the position matches the parent if we have one
 	if(_ecs->entities[i].parentTransform != NULL){
-		transform->pos = Vec3_ADD(parentTransform->pos, transform->localPos);
-		transform->scale = Vec3_MULT(parentTransform->scale, transform->localScale);
-		transform->rot = Vec3_ADD(parentTransform->rot, transform->localRot);
+		Vec3 pos = Vec3_ADD(parentTransform->pos, transform->localPos);
+		Vec3 scale = Vec3_MULT(parentTransform->scale, transform->localScale);
+		Vec3 rot = Vec3_ADD(parentTransform->rot, transform->localRot);
+		// only flag the transform if following the parent actually moved it
+		if(Vec3_EQUAL(pos, transform->pos) == FALSE || Vec3_EQUAL(scale, transform->scale) == FALSE || Vec3_EQUAL(rot, transform->rot) == FALSE){
+			transform->pos = pos;
+			transform->scale = scale;
+			transform->rot = rot;
+			transform->isDirty = TRUE;
+		}
 	}
 	AF_C3DRigidbody* rigidbody = &_ecs->rigidbodies[i];
 	if((AF_Component_GetHas(rigidbody->enabled) == TRUE) && (AF_Component_GetEnabled(rigidbody->enabled) == TRUE)){
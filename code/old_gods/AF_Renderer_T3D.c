@@ -91,12 +91,27 @@ typedef struct RendererDebugData {
     uint16_t entitiesCount;
     uint16_t totalMeshes;
     uint16_t totalTris;
+    uint16_t rebuiltMatrices;
     float totalRenderTime;
     float totalEntityRenderTime;
 } RendererDebugData;
 
 RendererDebugData rendererDebugData;
 
+// ============ MODEL MATRICES ============
+// values each model matrix was last built from, anything else changing the transform
+// without setting 'isDirty' (game code writing pos/rot/scale directly) is caught by comparing against these
+typedef struct BuiltTransform {
+    Vec3 pos;
+    Vec3 rot;
+    Vec3 scale;
+    BOOL isValid;
+} BuiltTransform;
+
+static BuiltTransform builtTransforms[AF_ECS_TOTAL_ENTITIES];
+static uint16_t dirtyMatrices[AF_ECS_TOTAL_ENTITIES];
+static uint16_t dirtyMatrixCount;
+
 float newTime;
 float deltaTime;
 
@@ -107,6 +122,7 @@ float deltaTime;
 void Renderer_RenderMesh(AF_CMesh* _mesh, AF_CTransform3D* _transform, float _dt);
 void Renderer_UpdateAnimations(AF_CSkeletalAnimation* _animation, float _dt);
 void Renderer_DebugCam();
+void Renderer_RebuildDirtyMatrices(AF_ECS* _ecs);
 /*=================
 AF_LoadTexture
 
@@ -254,6 +270,11 @@ void AF_Renderer_LateStart(AF_ECS* _ecs){
     int totalNormalMeshCommands = 0;
     int totalDrawCommands = 0;
 
+    // model matrices are allocated below, none of them are built yet
+    for(int i = 0; i < AF_ECS_TOTAL_ENTITIES; ++i){
+        builtTransforms[i].isValid = FALSE;
+    }
+
     // Load the skinned meshes, and setup memory
     for(int i=0; i<_ecs->entitiesCount; ++i) {
         AF_CMesh* mesh = &_ecs->meshes[i];
@@ -437,6 +458,7 @@ void AF_Renderer_Update(AF_ECS* _ecs, AF_Time* _time){
     // ======== Update Animations, and collect data about the mesh ======== //
     rendererDebugData.totalTris = 0;
     rendererDebugData.totalMeshes = 0;
+    dirtyMatrixCount = 0;
     
    
     for(int i = 0; i < _ecs->entitiesCount; ++i){
@@ -470,23 +492,25 @@ void AF_Renderer_Update(AF_ECS* _ecs, AF_Time* _time){
             }
    
             // ======== MODELS ========
-            // Update the mesh model matrix based on the entity transform.
+            // Only queue the mesh model matrix for a rebuild if the entity transform changed.
             AF_CTransform3D* entityTransform = &_ecs->transforms[i];
-            float pos[3] = {entityTransform->pos.x, entityTransform->pos.y, entityTransform->pos.z};
-            float rot[3]= {entityTransform->rot.x, entityTransform->rot.y, entityTransform->rot.z};
-            float scale[3] = {entityTransform->scale.x, entityTransform->scale.y, entityTransform->scale.z};
-
-            T3DMat4FP* meshMat = (T3DMat4FP*)mesh->modelMatrix;
-            
-            if(meshMat == NULL){
+            if(mesh->modelMatrix == NULL){
                 debugf("AF_Renderer_T3D: AF_RenderUpdate modelsMat %i mesh ID %i mesh type %i is null\n",i, mesh->meshID, mesh->meshType);
                 continue;
             }
-            t3d_mat4fp_from_srt_euler(meshMat,  scale, rot, pos);
-        
+
+            BuiltTransform* built = &builtTransforms[i];
+            if(entityTransform->isDirty == TRUE || built->isValid == FALSE
+                || Vec3_EQUAL(entityTransform->pos, built->pos) == FALSE
+                || Vec3_EQUAL(entityTransform->rot, built->rot) == FALSE
+                || Vec3_EQUAL(entityTransform->scale, built->scale) == FALSE){
+                dirtyMatrices[dirtyMatrixCount++] = i;
+            }
         }
     }
 
+    Renderer_RebuildDirtyMatrices(_ecs);
+
 
     
     //scrollingBufferUVList = rspq_block_end();
@@ -692,6 +716,29 @@ void Renderer_UpdateAnimations(AF_CSkeletalAnimation* _animation, float _dt){
 }
 
 
+/*
+====================
+Renderer_RebuildDirtyMatrices
+Converts the transforms of all queued entities to their fixed-point model matrix in one pass
+====================
+*/
+void Renderer_RebuildDirtyMatrices(AF_ECS* _ecs){
+    for(int d = 0; d < dirtyMatrixCount; ++d){
+        int i = dirtyMatrices[d];
+        AF_CTransform3D* transform = &_ecs->transforms[i];
+        BuiltTransform* built = &builtTransforms[i];
+
+        built->pos = transform->pos;
+        built->rot = transform->rot;
+        built->scale = transform->scale;
+        built->isValid = TRUE;
+        transform->isDirty = FALSE;
+
+        t3d_mat4fp_from_srt_euler((T3DMat4FP*)_ecs->meshes[i].modelMatrix, &built->scale.x, &built->rot.x, &built->pos.x);
+    }
+    rendererDebugData.rebuiltMatrices = dirtyMatrixCount;
+}
+
 /*
 ====================
 Renderer_RenderMesh
@@ -933,6 +980,7 @@ void Renderer_DebugCam(RendererDebugData* _rendererDebugData){
     rdpq_text_printf(NULL, FONT2_ID, 50, 20, "Entities  : %i", _rendererDebugData->entitiesCount);
     rdpq_text_printf(NULL, FONT2_ID, 50, 30, "Meshs  : %i", _rendererDebugData->totalMeshes);
     rdpq_text_printf(NULL, FONT2_ID, 50, 40, "Tris  : %i", _rendererDebugData->totalTris);
+    rdpq_text_printf(NULL, FONT2_ID, 200, 30, "Matrices  : %i/%i", _rendererDebugData->rebuiltMatrices, _rendererDebugData->totalMeshes);
     
     rdpq_text_printf(NULL, FONT2_ID, 50, 50, "Total Render: %.2fms", _rendererDebugData->totalRenderTime);
     rdpq_text_printf(NULL, FONT2_ID, 50, 60, "Entity Render: %.2fms", _rendererDebugData->totalEntityRenderTime);
@@ -13,6 +13,7 @@ Implmentation of functions and code relating to the UI menu in the game
 
 #include "../../minigame.h"
 #include "../../core.h"
+#include "../../assetcache.h"
 
 // Key mappings for n64 controller to joypad_button struct, polled from libdragon
 #define A_KEY 0			// A Button		
@@ -117,10 +118,10 @@ float countDownTimer;
 
 // ==== GAME SOUNDS ====
 wav64_t music_2;
-wav64_t sfx_start;
-wav64_t sfx_countdown;
-wav64_t sfx_stop;
-wav64_t sfx_winner;
+wav64_t* sfx_start;
+wav64_t* sfx_countdown;
+wav64_t* sfx_stop;
+wav64_t* sfx_winner;
 wav64_t sfx_startButton;
 
 // ==== FONT ====
@@ -290,10 +291,10 @@ void UI_Menu_Shutdown(AF_ECS* _ecs){
     }
 
     // ===== Destroy Audio ===== 
-    wav64_close(&sfx_start);
-    wav64_close(&sfx_countdown);
-    wav64_close(&sfx_stop);
-    wav64_close(&sfx_winner);
+    assetcache_release_sound(sfx_start);
+    assetcache_release_sound(sfx_countdown);
+    assetcache_release_sound(sfx_stop);
+    assetcache_release_sound(sfx_winner);
     mixer_ch_stop(0);
     wav64_close(&music_2);
     wav64_close(&sfx_startButton);
@@ -738,7 +739,7 @@ void UI_Menu_RenderGameOverScreen(AppData* _appData ){
     if(isDeclaredWinner == FALSE){
         mixer_ch_stop(0);
         wav64_close(&music_2);
-        wav64_play(&sfx_winner, 31);
+        wav64_play(sfx_winner, 31);
         //xm64player_stop(&music);
         isDeclaredWinner = TRUE;
         isMusicPlaying = FALSE;
@@ -789,7 +790,7 @@ void UI_Menu_RenderCountdown(AppData* _appData){
         float prevCountDown = countDownTimer;
         countDownTimer -= _appData->gameTime.timeSinceLastFrame;
         if ((int)prevCountDown != (int)countDownTimer && countDownTimer >= 0){
-            wav64_play(&sfx_countdown, 31);
+            wav64_play(sfx_countdown, 31);
             // update the char buffer that will be the onscreen text. ensure there
             sprintf(startCountdownCharBuffer, "%i", ((int)countDownTimer)+1);
             startCountdownLabelEntity->text->text = startCountdownCharBuffer;
@@ -798,7 +799,7 @@ void UI_Menu_RenderCountdown(AppData* _appData){
         return;
     }
     // this will only play once
-    wav64_play(&sfx_start, 31);
+    wav64_play(sfx_start, 31);
     isStartedPlaying = TRUE;
    
     
@@ -844,10 +845,10 @@ UI_Menu_RenderCountdown
 Render in game count down clock
  ================ */
 void UI_Menu_SetupAudio(){
-  wav64_open(&sfx_start, AUDIO_START_FX); //"rom:/core/Start.wav64");
-  wav64_open(&sfx_countdown, AUDIO_COUNTDOWN_FX); //"rom:/core/Countdown.wav64");
-  wav64_open(&sfx_stop, AUDIO_STOP_FX); //"rom:/core/Stop.wav64");
-  wav64_open(&sfx_winner, AUDIO_WINNER_FX); //"rom:/core/Winner.wav64");
+  sfx_start = assetcache_get_sound(AUDIO_START_FX);
+  sfx_countdown = assetcache_get_sound(AUDIO_COUNTDOWN_FX);
+  sfx_stop = assetcache_get_sound(AUDIO_STOP_FX);
+  sfx_winner = assetcache_get_sound(AUDIO_WINNER_FX);
   wav64_open(&sfx_startButton, AUDIO_BUTTON_PRESS_FX); //"rom:/old_gods/Item2A.wav64");
   
   mixer_ch_set_vol(31, 0.5f, 0.5f);
@@ -136,7 +136,7 @@ void AI::tryChangeState(Player& player, AIState newState) {
     player.multiplier2 = 1.f + AIRandomRange * (static_cast<float>(rand()) / RAND_MAX);
 }
 
-void AI::calculateMovement(Player& player, float deltaTime, std::vector<Player> &players, GameState &state, T3DVec3 &inputDirection) {
+void AI::calculateMovement(Player& player, float deltaTime, std::vector<Player> &players, GameState &state, MapRenderer &map, T3DVec3 &inputDirection) {
     float random = static_cast<float>(rand()) / RAND_MAX;
 
     // Defaults
@@ -150,6 +150,7 @@ void AI::calculateMovement(Player& player, float deltaTime, std::vector<Player>
     float playerRepulsion = 0.f;
 
     float alignment = 0.1f;
+    float paintAttraction = 0.f;
 
     if (difficulty == AiDiff::DIFF_EASY) {
         escapeWeight = 1.f;
@@ -187,6 +188,13 @@ void AI::calculateMovement(Player& player, float deltaTime, std::vector<Player>
         playerRepulsion = 0.3f * player.multiplier2;
 
         alignment *= player.multiplier;
+
+        // Easy doesn't care about territory
+        if (difficulty == AiDiff::DIFF_MEDIUM) {
+            paintAttraction = 0.5f * AIPaintAttraction;
+        } else if (difficulty == AiDiff::DIFF_HARD) {
+            paintAttraction = AIPaintAttraction;
+        }
     } else if (player.aiState == AIState::AI_DEFEND) {
         centerAttraction = 0.4f;
 
@@ -254,6 +262,38 @@ void AI::calculateMovement(Player& player, float deltaTime, std::vector<Player>
         t3d_vec3_add(inputDirection, inputDirection, force);
     }
 
+    // paint attraction, the tile counts are a few frames behind which is fine here
+    if (paintAttraction > 0.f) {
+        float halfSize = map.getHalfSize();
+        float bestCoverage = map.getTileCoverage(player.pos.v[0], player.pos.v[2], player.team);
+        T3DVec3 target = player.pos;
+        for (int dz = -1; dz <= 1; dz++) {
+            for (int dx = -1; dx <= 1; dx++) {
+                // A tile is one segment wide in world units
+                float x = player.pos.v[0] + dx * SegmentSize;
+                float z = player.pos.v[2] + dz * SegmentSize;
+                if (std::abs(x) > halfSize || std::abs(z) > halfSize) {
+                    continue;
+                }
+
+                float tileCoverage = map.getTileCoverage(x, z, player.team);
+                if (tileCoverage < bestCoverage) {
+                    bestCoverage = tileCoverage;
+                    target = T3DVec3 {x, 0.f, z};
+                }
+            }
+        }
+
+        T3DVec3 force = {0};
+        t3d_vec3_diff(force, target, player.pos);
+        force.v[1] = 0.f;
+        if (t3d_vec3_len(force) > 0.f) {
+            t3d_vec3_norm(force);
+            t3d_vec3_scale(force, force, paintAttraction);
+            t3d_vec3_add(inputDirection, inputDirection, force);
+        }
+    }
+
     for (auto& other : players) {
         if (&other == &player) {
             continue;
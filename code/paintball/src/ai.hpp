@@ -11,6 +11,8 @@
 constexpr float AITemperature = 0.06f;
 constexpr float AIUnstable = 0.02f;
 constexpr float AIActionRateSecond = 0.2;
+// Pull towards the neighbouring tile with the least paint of the AI's team
+constexpr float AIPaintAttraction = 0.3f;
 
 class AI
 {
@@ -22,7 +24,7 @@ class AI
     public:
         AI();
         Direction calculateFireDirection(Player&, float deltaTime, std::vector<Player> &players, GameState &state);
-        void calculateMovement(Player&, float deltaTime, std::vector<Player> &players, GameState &state, T3DVec3 &inputDirection);
+        void calculateMovement(Player&, float deltaTime, std::vector<Player> &players, GameState &state, MapRenderer &map, T3DVec3 &inputDirection);
 };
 
 #endif // __AI_H
@@ -25,6 +25,10 @@ constexpr float CooldownPerSecond = 1.f;
 constexpr float TempPerBullet = 0.35f;
 constexpr float OverheatPenalty = 1.5f;
 
+// Counts paint per team by reading tiles back from the paint surface,
+// the AI uses the counts to look for ground to paint
+constexpr bool TrackPaintCoverage = true;
+
 // AI
 constexpr float AICloseRange = 100;
 constexpr float AIFarRange = 200;
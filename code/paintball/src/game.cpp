@@ -14,9 +14,9 @@ Game::Game() :
         .scores = {0},
         .winnerCount = 0,
     }),
-    sfxStart("rom:/core/Start.wav64"),
-    sfxFinish("rom:/core/Winner.wav64"),
-    sfxLastOne("rom:/core/Stop.wav64")
+    sfxStart(ASSETCACHE_SFX_START),
+    sfxFinish(ASSETCACHE_SFX_WINNER),
+    sfxLastOne(ASSETCACHE_SFX_STOP)
 {
     rdpq_fontstyle_t p1Style = { .color = PLAYERCOLOR_1 };
     rdpq_fontstyle_t p2Style = { .color = PLAYERCOLOR_2 };
@@ -51,9 +51,9 @@ class Game
 
         GameState state;
 
-        Wav64 sfxStart;
-        Wav64 sfxFinish;
-        Wav64 sfxLastOne;
+        CachedWav64 sfxStart;
+        CachedWav64 sfxFinish;
+        CachedWav64 sfxLastOne;
 
         void gameOver();
         void processState();
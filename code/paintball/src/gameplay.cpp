@@ -214,7 +214,7 @@ void GameplayController::fixedUpdate(float deltaTime, GameState &state)
             direction.v[0] = (float)joypad.stick_x;
             direction.v[2] = -(float)joypad.stick_y;
         } else {
-            ai.calculateMovement(player, deltaTime, playerData, state, direction);
+            ai.calculateMovement(player, deltaTime, playerData, state, *map, direction);
         }
         simulatePhysics(player, id, deltaTime, direction);
         id++;
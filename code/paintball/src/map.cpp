@@ -15,12 +15,20 @@ MapRenderer::MapRenderer() :
     tlut {
         (uint16_t*)malloc_uncached(sizeof(uint16_t[256])),
         free_uncached
-    }
+    },
+    tileCoverage {},
+    queuedTiles {0},
+    countedTiles {0},
+    isCounting(false),
+    countedPaint(0),
+    submittedPaints(0),
+    finishedPaints(0)
 {
     debugf("Map renderer initialized\n");
     assertf(surface.get(), "surface is null");
 
     mapSize = 1.f;
+    coloredCount = -1;
 
     rdpq_attach(surface.get(), nullptr);
         rdpq_set_scissor(0, 0, MapWidth, MapWidth);
@@ -53,7 +61,6 @@ MapRenderer::MapRenderer() :
             int16_t x = ix * SegmentSize-SegmentSize * MapWidth/TileSize / 2;
             int16_t y = iy * SegmentSize-SegmentSize * MapWidth/TileSize / 2;
 
-            // TODO: convert to tri strip
             vertices[idx * 2] = (T3DVertPacked){
                 .posA = {x, 0, y},
                 .normA = norm,
@@ -122,62 +129,168 @@ MapRenderer::MapRenderer() :
 MapRenderer::~MapRenderer() {
     debugf("Map renderer de-initialized\n");
 
+    // The last paint calls back into this
+    rspq_wait();
+
     free_uncached(vertices);
 }
 
 void MapRenderer::render(float deltaTime, const T3DFrustum &frustum) {
-    for (auto splash = newSplashes.begin(); splash < newSplashes.end(); ++splash) {
-        __splash(*splash);
+    __paint();
+
+    int halfSegmentCount = TileCount/2;
+    int effectiveCount = (int)(halfSegmentCount * mapSize);
+    if (effectiveCount < MinSegmentCount/2) effectiveCount = MinSegmentCount/2;
+    if (effectiveCount != coloredCount) {
+        coloredCount = effectiveCount;
+        __updateColors();
     }
-    newSplashes.clear();
-
-    for (auto step = newFootsteps.begin(); step < newFootsteps.end(); ++step) {
-        __step(*step);
-    }
-    newFootsteps.clear();
 
     rspq_block_run(renderModeBlock.get());
 
-    for (int iy = 0; iy < MapWidth/TileSize; iy++) {
-        for (int ix = 0; ix < MapWidth/TileSize; ix++ ) {
-            int idx = iy * (MapWidth/TileSize) + ix;
-
-            int halfSegmentCount = (MapWidth/TileSize)/2;
-            int effectiveCount = (int)(halfSegmentCount * mapSize);
-            if (effectiveCount < MinSegmentCount/2) effectiveCount = MinSegmentCount/2;
+    for (int iy = 0; iy < TileCount; iy++) {
+        // Find the visible groups of the row, the whole span between
+        // the first and last one is loaded in one go
+        uint32_t visibleGroups = 0;
+        int first = -1;
+        int last = -1;
+        for (int ix = 0; ix < TileCount; ix += TilesPerUpload) {
+            int idx = iy * TileCount + ix;
 
             // This assumes zero height
-            bool visible = t3d_frustum_vs_aabb_s16(&frustum, vertices[idx * 2].posA, vertices[idx * 2+1].posB);
+            bool visible = t3d_frustum_vs_aabb_s16(&frustum, vertices[idx * 2].posA, vertices[(idx + TilesPerUpload - 1) * 2 + 1].posB);
             if (!visible) continue;
 
-            if (std::abs(ix - halfSegmentCount + 0.5f) > effectiveCount ||
-                std::abs(iy - halfSegmentCount + 0.5f) > effectiveCount) {
-                vertices[idx * 2].rgbaA = 0xAAAAAA'FF;
-                vertices[idx * 2].rgbaB = 0xAAAAAA'FF;
-                vertices[idx * 2+1].rgbaA = 0xAAAAAA'FF;
-                vertices[idx * 2+1].rgbaB = 0xAAAAAA'FF;
-            } else {
-                vertices[idx * 2].rgbaA = 0xFFFFFF'FF;
-                vertices[idx * 2].rgbaB = 0xFFFFFF'FF;
-                vertices[idx * 2+1].rgbaA = 0xFFFFFF'FF;
-                vertices[idx * 2+1].rgbaB = 0xFFFFFF'FF;
-            }
+            visibleGroups |= 1 << ix;
+            if (first < 0) first = ix;
+            last = ix;
+        }
+        if (first < 0) continue;
+
+        // At most 64 vertices per row, so this fits in the vertex cache
+        int firstIdx = iy * TileCount + first;
+        t3d_vert_load(&vertices[firstIdx * 2], 0, (last + TilesPerUpload - first) * 4);
+
+        for (int ix = first; ix <= last; ix += TilesPerUpload) {
+            if (!(visibleGroups & (1 << ix))) continue;
 
             int pixelX = ix * TileSize;
             int pixelY = iy * TileSize;
             rdpq_sync_tile();
             rdpq_sync_load();
-            rdpq_sync_pipe();
 
-            rdpq_tex_upload_sub(TILE0, surface.get(), NULL, pixelX, pixelY, pixelX+TileSize, pixelY+TileSize);
+            rdpq_tex_upload_sub(TILE0, surface.get(), NULL, pixelX, pixelY, pixelX + TileSize * TilesPerUpload, pixelY + TileSize);
+
+            for (int i = 0; i < TilesPerUpload; i++) {
+                int v = (ix + i - first) * 4;
+                t3d_tri_draw(v, v + 1, v + 2);
+                t3d_tri_draw(v + 2, v + 1, v + 3);
+            }
+            t3d_tri_sync();
+        }
+    }
+}
+
+void MapRenderer::__updateColors() {
+    int halfSegmentCount = TileCount/2;
+    for (int iy = 0; iy < TileCount; iy++) {
+        for (int ix = 0; ix < TileCount; ix++) {
+            int idx = iy * TileCount + ix;
 
-            // TODO: this is not efficient, load more vertices
-            t3d_vert_load(&vertices[idx * 2], 0, 4);
+            uint32_t color = 0xFFFFFF'FF;
+            if (std::abs(ix - halfSegmentCount + 0.5f) > coloredCount ||
+                std::abs(iy - halfSegmentCount + 0.5f) > coloredCount) {
+                color = 0xAAAAAA'FF;
+            }
+            vertices[idx * 2].rgbaA = color;
+            vertices[idx * 2].rgbaB = color;
+            vertices[idx * 2+1].rgbaA = color;
+            vertices[idx * 2+1].rgbaB = color;
+        }
+    }
+}
 
-            t3d_tri_draw(0, 1, 2);
-            t3d_tri_draw(2, 1, 3);
+void MapRenderer::__countTile(int ix, int iy) {
+    int idx = iy * TileCount + ix;
+    surface_t *s = surface.get();
+
+    uint16_t counts[PlayerCount + 1] = {0};
+    for (int y = 0; y < TileSize; y++) {
+        uint8_t *row = (uint8_t*)CachedAddr((uint8_t*)s->buffer + (iy * TileSize + y) * s->stride + ix * TileSize);
+        // Only the RDP writes to the surface, drop any stale lines
+        data_cache_hit_invalidate(row, TileSize);
+        for (int x = 0; x < TileSize; x++) {
+            if (row[x] <= PlayerCount) counts[row[x]]++;
         }
     }
+
+    for (int i = 0; i < PlayerCount; i++) {
+        tileCoverage[idx][i] = counts[i + 1];
+    }
+}
+
+void MapRenderer::__updateCoverage() {
+    if (isCounting) {
+        if ((int32_t)(finishedPaints - countedPaint) < 0) return;
+
+        for (int iy = 0; iy < TileCount; iy++) {
+            for (int ix = 0; ix < TileCount; ix++) {
+                if (countedTiles[iy] & (1 << ix)) __countTile(ix, iy);
+            }
+        }
+        countedTiles.fill(0);
+        isCounting = false;
+    }
+
+    bool hasQueued = false;
+    for (auto row : queuedTiles) hasQueued |= row != 0;
+    if (!hasQueued) return;
+
+    // Everything queued so far has been submitted, so waiting for the
+    // last paint is enough
+    countedTiles = queuedTiles;
+    queuedTiles.fill(0);
+    countedPaint = submittedPaints;
+    isCounting = true;
+}
+
+void MapRenderer::__queueTiles(int x0, int y0, int x1, int y1) {
+    x0 = std::max(x0, 0) / TileSize;
+    y0 = std::max(y0, 0) / TileSize;
+    x1 = std::min(x1, MapWidth - 1) / TileSize;
+    y1 = std::min(y1, MapWidth - 1) / TileSize;
+
+    for (int iy = y0; iy <= y1; iy++) {
+        for (int ix = x0; ix <= x1; ix++) {
+            queuedTiles[iy] |= 1 << ix;
+        }
+    }
+}
+
+void MapRenderer::__paint() {
+    if constexpr (TrackPaintCoverage) __updateCoverage();
+
+    if (newSplashes.begin() == newSplashes.end() && newFootsteps.begin() == newFootsteps.end()) return;
+
+    rdpq_attach(surface.get(), nullptr);
+        rspq_block_run(paintBlock.get());
+
+        for (auto splash = newSplashes.begin(); splash < newSplashes.end(); ++splash) {
+            __splash(*splash);
+        }
+
+        for (auto step = newFootsteps.begin(); step < newFootsteps.end(); ++step) {
+            __step(*step);
+        }
+    if constexpr (TrackPaintCoverage) {
+        rdpq_detach_cb([](void* self) -> void { ((MapRenderer*)self)->finishedPaints++; }, this);
+        submittedPaints++;
+    } else {
+        rdpq_detach();
+    }
+
+    newSplashes.clear();
+    newFootsteps.clear();
 }
 
 void MapRenderer::__splash(Splash &splash) {
@@ -190,33 +303,30 @@ void MapRenderer::__splash(Splash &splash) {
     int id = randomRange(0, SplashVariations - 1);
     surface_t s = sprite_get_pixels(splashSprites[id].get());
 
-    rdpq_attach(surface.get(), nullptr);
-        rspq_block_run(paintBlock.get());
-
-        rdpq_set_scissor(splash.x - safeMargin, splash.y - safeMargin, splash.x + safeMargin, splash.y + safeMargin);
-        rdpq_blitparms_t params {
-            .width = 32,
-            .height = 32,
-            .flip_x = (bool)randomRange(0, 1),
-            .flip_y = true,
-            .cx = 16,
-            .cy = 16,
-            .scale_x = 0.8f + static_cast<float>(rand()) / RAND_MAX,
-            .scale_y = 0.8f + static_cast<float>(rand()) / RAND_MAX,
-            .theta = splash.direction,
-        };
-        // Set all channels to the same value b/c for an I8 target, RDP will
-        // interleave R&G channels
-        rdpq_set_prim_color(
-            RGBA32(
-                (uint8_t)(splash.team + 1),
-                (uint8_t)(splash.team + 1),
-                (uint8_t)(splash.team + 1),
-                255
-            )
-        );
-        rdpq_tex_blit(&s, splash.x, splash.y, &params);
-    rdpq_detach();
+    if constexpr (TrackPaintCoverage) __queueTiles(splash.x - safeMargin, splash.y - safeMargin, splash.x + safeMargin, splash.y + safeMargin);
+    rdpq_set_scissor(splash.x - safeMargin, splash.y - safeMargin, splash.x + safeMargin, splash.y + safeMargin);
+    rdpq_blitparms_t params {
+        .width = 32,
+        .height = 32,
+        .flip_x = (bool)randomRange(0, 1),
+        .flip_y = true,
+        .cx = 16,
+        .cy = 16,
+        .scale_x = 0.8f + static_cast<float>(rand()) / RAND_MAX,
+        .scale_y = 0.8f + static_cast<float>(rand()) / RAND_MAX,
+        .theta = splash.direction,
+    };
+    // Set all channels to the same value b/c for an I8 target, RDP will
+    // interleave R&G channels
+    rdpq_set_prim_color(
+        RGBA32(
+            (uint8_t)(splash.team + 1),
+            (uint8_t)(splash.team + 1),
+            (uint8_t)(splash.team + 1),
+            255
+        )
+    );
+    rdpq_tex_blit(&s, splash.x, splash.y, &params);
 }
 
 void MapRenderer::__step(Splash &step) {
@@ -227,32 +337,29 @@ void MapRenderer::__step(Splash &step) {
 
     surface_t s = sprite_get_pixels(footstep.get());
 
-    rdpq_attach(surface.get(), nullptr);
-        rspq_block_run(paintBlock.get());
-
-        rdpq_set_scissor(step.x - 16, step.y - 16, step.x + 16, step.y + 16);
-        rdpq_blitparms_t params {
-            .width = 8,
-            .height = 8,
-            .flip_x = !step.isFirst,
-            .flip_y = true,
-            .cx = 0,
-            .cy = 4,
-            .theta = step.direction,
-
-        };
-        // Set all channels to the same value b/c for an I8 target, RDP will
-        // interleave R&G channels
-        rdpq_set_prim_color(
-            RGBA32(
-                (uint8_t)(step.team + 1),
-                (uint8_t)(step.team + 1),
-                (uint8_t)(step.team + 1),
-                255
-            )
-        );
-        rdpq_tex_blit(&s, step.x, step.y, &params);
-    rdpq_detach();
+    if constexpr (TrackPaintCoverage) __queueTiles(step.x - 16, step.y - 16, step.x + 16, step.y + 16);
+    rdpq_set_scissor(step.x - 16, step.y - 16, step.x + 16, step.y + 16);
+    rdpq_blitparms_t params {
+        .width = 8,
+        .height = 8,
+        .flip_x = !step.isFirst,
+        .flip_y = true,
+        .cx = 0,
+        .cy = 4,
+        .theta = step.direction,
+
+    };
+    // Set all channels to the same value b/c for an I8 target, RDP will
+    // interleave R&G channels
+    rdpq_set_prim_color(
+        RGBA32(
+            (uint8_t)(step.team + 1),
+            (uint8_t)(step.team + 1),
+            (uint8_t)(step.team + 1),
+            255
+        )
+    );
+    rdpq_tex_blit(&s, step.x, step.y, &params);
 }
 
 void MapRenderer::splash(float x, float y, PlyNum team, float direction) {
@@ -292,4 +399,16 @@ float MapRenderer::getHalfSize() {
 void MapRenderer::setSize(float size) {
     assertf(size <= 1.f && size >= 0.f, "Incorrect size");
     mapSize = size;
-}
\ No newline at end of file
+}
+
+float MapRenderer::getTileCoverage(float x, float y, PlyNum team) {
+    float distancePerSegment = SegmentSize * (MapWidth/TileSize);
+    float pixelX = (x/distancePerSegment) * MapWidth + MapWidth/2.f;
+    float pixelY = (y/distancePerSegment) * MapWidth + MapWidth/2.f;
+    if (pixelX < 0.f || pixelX >= MapWidth || pixelY < 0.f || pixelY >= MapWidth) return 0.f;
+
+    int ix = (int)pixelX / TileSize;
+    int iy = (int)pixelY / TileSize;
+
+    return tileCoverage[iy * TileCount + ix][team] / (float)(TileSize * TileSize);
+}
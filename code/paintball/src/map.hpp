@@ -7,6 +7,8 @@
 #include <t3d/t3dmath.h>
 #include <t3d/t3dmodel.h>
 
+#include <algorithm>
+#include <array>
 #include <memory>
 #include <vector>
 #include <cstdlib>
@@ -24,6 +26,12 @@ constexpr int SegmentSize = 75;
 constexpr int MinSegmentCount = 4;
 constexpr int SplashVariations = 4;
 
+constexpr int TileCount = MapWidth / TileSize;
+// Two CI8 tiles fill the 2KB of TMEM that the TLUT leaves free,
+// so they are uploaded and drawn together
+constexpr int TilesPerUpload = 2;
+static_assert(TileCount <= 16, "Tile rows are tracked as 16 bit masks");
+
 struct Splash {
     float x;
     float y;
@@ -54,7 +62,29 @@ class MapRenderer
 
         // As a ratio of the maximum map size
         float mapSize;
+        // Half of the tiles per side that are not greyed out,
+        // the vertex colors are rewritten when it changes
+        int coloredCount;
+
+        // Painted pixels of every team, per tile.
+        // Only the tiles that were painted over are counted again,
+        // once the RDP has finished drawing to them.
+        uint16_t tileCoverage[TileCount * TileCount][PlayerCount];
+
+        // Tiles touched by paint, one bit per column. Queued tiles wait
+        // for the next count, the counted ones for countedPaint to finish.
+        std::array<uint16_t, TileCount> queuedTiles;
+        std::array<uint16_t, TileCount> countedTiles;
+        bool isCounting;
+        uint32_t countedPaint;
+        uint32_t submittedPaints;
+        volatile uint32_t finishedPaints;
 
+        void __updateColors();
+        void __updateCoverage();
+        void __countTile(int ix, int iy);
+        void __queueTiles(int x0, int y0, int x1, int y1);
+        void __paint();
         void __splash(Splash &splash);
         void __step(Splash &);
     public:
@@ -65,6 +95,9 @@ class MapRenderer
         void step(float x, float y, PlyNum team, float direction, bool firstStep);
         float getHalfSize();
         void setSize(float size);
+        // As a ratio of the tile at the given position, which is a few frames behind.
+        // Only counted with TrackPaintCoverage, 0 otherwise
+        float getTileCoverage(float x, float y, PlyNum team);
 };
 
 #endif // __MAP_H
@@ -7,7 +7,7 @@ UIRenderer::UIRenderer() :
     // TODO: re-use existing one, this is a waste
     splash1 {sprite_load("rom:/paintball/splash1.ia4.sprite"), sprite_free},
     splash2 {sprite_load("rom:/paintball/splash2.ia4.sprite"), sprite_free},
-    sfxCountdown("rom:/core/Countdown.wav64"),
+    sfxCountdown(ASSETCACHE_SFX_COUNTDOWN),
     prevCountdown(0)
 {
     rdpq_fontstyle_t p1Style = { .color = PLAYERCOLOR_1 };
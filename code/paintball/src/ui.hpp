@@ -33,7 +33,7 @@ class UIRenderer
 
         List<HitMark, PlayerCount * 4> hits;
 
-        Wav64 sfxCountdown;
+        CachedWav64 sfxCountdown;
         int prevCountdown;
 
         void renderHitMarks(T3DViewport &viewport, float deltaTime);
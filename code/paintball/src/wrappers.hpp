@@ -8,6 +8,8 @@
 #include <t3d/t3danim.h>
 #include <t3d/t3dmodel.h>
 
+#include "../../../assetcache.h"
+
 class Display
 {
     private:
@@ -142,6 +144,23 @@ class Wav64
         };
 };
 
+// Sound shared with the other minigames, stays loaded after we're done with it
+class CachedWav64
+{
+    private:
+        wav64_t* wav;
+    public:
+        CachedWav64(const char *name) {
+            wav = assetcache_get_sound(name);
+        };
+        ~CachedWav64() {
+            assetcache_release_sound(wav);
+        };
+        wav64_t* get() {
+            return wav;
+        };
+};
+
 namespace U {
     using RSPQBlock = std::unique_ptr<rspq_block_t, decltype(&rspq_block_free)>;
     using T3DMat4FP = std::unique_ptr<T3DMat4FP, decltype(&free_uncached)>;
@@ -1,5 +1,6 @@
 #include <libdragon.h>
 #include "../../core.h"
+#include "../../assetcache.h"
 #include "../../minigame.h"
 #include <t3d/t3d.h>
 #include <t3d/t3dmath.h>
@@ -163,8 +164,8 @@ T3DVec3 lightDirVec;
 
 wav64_t sfx_start;
 wav64_t sfx_countdown;
-wav64_t sfx_stop;
-wav64_t sfx_winner;
+wav64_t* sfx_stop;
+wav64_t* sfx_winner;
 wav64_t sfx_music;
 
 rspq_syncpoint_t syncPoint;
@@ -412,8 +413,8 @@ void minigame_init()
     syncPoint = 0;
     wav64_open(&sfx_start, "rom:/riistahillo/bop.wav64");
     wav64_open(&sfx_countdown, "rom:/riistahillo/bap.wav64");
-    wav64_open(&sfx_stop, "rom:/core/Stop.wav64");
-    wav64_open(&sfx_winner, "rom:/core/Winner.wav64");
+    sfx_stop = assetcache_get_sound(ASSETCACHE_SFX_STOP);
+    sfx_winner = assetcache_get_sound(ASSETCACHE_SFX_WINNER);
     wav64_open(&sfx_music, "rom:/riistahillo/jam.wav64");
     mixer_ch_set_vol(31, 0.5f, 0.5f);
 }
@@ -753,11 +754,11 @@ void minigame_loop(float deltatime)
 
         if(playerAlive > 0)
         {
-            wav64_play(&sfx_winner, 31);
+            wav64_play(sfx_winner, 31);
         }
         else
         {
-            wav64_play(&sfx_stop, 31);
+            wav64_play(sfx_stop, 31);
         }
         
         for(int i = 0; i < MAXPLAYERS; ++i)
@@ -914,8 +915,8 @@ void minigame_cleanup()
 {
     wav64_close(&sfx_start);
     wav64_close(&sfx_countdown);
-    wav64_close(&sfx_stop);
-    wav64_close(&sfx_winner);
+    assetcache_release_sound(sfx_stop);
+    assetcache_release_sound(sfx_winner);
 
     rspq_block_free(dplController);
     rspq_block_free(dplControllerDPadLeft);
@@ -1,6 +1,13 @@
 #ifndef ACTOR_H
 #define ACTOR_H
 
+// Matrices and bones are written while the RSP may still be drawing the
+// previous frames, so keep one copy per display buffer
+#define ACTOR_BUFFER_COUNT 3
+
+// Bounding sphere radius used to skip the skeleton update of off-screen actors
+#define ACTOR_CULL_RADIUS 150.0f
+
 // structures
 
 typedef struct
@@ -86,7 +93,8 @@ typedef struct
 
 	uint32_t id;
 	rspq_block_t *dl;
-	T3DMat4FP *modelMat;
+	T3DMat4FP *modelMat; // ACTOR_BUFFER_COUNT matrices
+	uint8_t modelMatIdx;
 	T3DModel *model;
 	Vector3 scale;
 
@@ -124,6 +132,8 @@ typedef struct
 
 Actor actor_create(uint32_t id, const char *model_path);
 
+void actor_updateMat(Actor *actor);
+void actor_updateSkeleton(Actor *actor, const T3DViewport *viewport);
 void actor_draw(Actor *actor);
 void actor_delete(Actor *actor);
 
@@ -135,7 +145,8 @@ Actor actor_create(uint32_t id, const char *model_path)
 
 		.id = id,
 		.model = t3d_model_load(model_path),
-		.modelMat = malloc_uncached(sizeof(T3DMat4FP)),
+		.modelMat = malloc_uncached(sizeof(T3DMat4FP) * ACTOR_BUFFER_COUNT),
+		.modelMatIdx = 0,
 
 		.scale = {1.0f, 1.0f, 1.0f},
 
@@ -154,15 +165,17 @@ Actor actor_create(uint32_t id, const char *model_path)
 		.settings = {.idle_acceleration_rate = 9, .walk_acceleration_rate = 4, .run_acceleration_rate = 10, .roll_acceleration_rate = 20, .roll_acceleration_grip_rate = 2, .jump_acceleration_rate = 60, .aerial_control_rate = 6.0, .walk_target_speed = 200, .run_target_speed = 700, .sprint_target_speed = 900, .idle_to_roll_target_speed = 300, .idle_to_roll_grip_target_speed = 50, .walk_to_roll_target_speed = 400, .run_to_roll_target_speed = 780, .sprint_to_roll_target_speed = 980, .jump_target_speed = 800, .jump_timer_max = 0.21, .fall_max_speed = -2650.0f, .jump_max_speed = 1000.0f, .jump_horizontal_boost = 125.0f, .jump_max_height = 1000.0f},
 	};
 
-	actor.armature.main = t3d_skeleton_create(actor.model);
+	actor.armature.main = t3d_skeleton_create_buffered(actor.model, ACTOR_BUFFER_COUNT);
 	// actor.armature.blend = t3d_skeleton_clone(&actor.armature.main, false);
 
+	// The matrix and bones change buffer every frame, so they are set outside the block
 	rspq_block_begin();
-	t3d_matrix_set(actor.modelMat, true);
-	t3d_model_draw_skinned(actor.model, &actor.armature.main);
+	T3DModelDrawConf drawConf = {.matrices = (const T3DMat4FP *)t3d_segment_placeholder(T3D_SEGMENT_SKELETON)};
+	t3d_model_draw_custom(actor.model, drawConf);
 	actor.dl = rspq_block_end();
 
-	t3d_mat4fp_identity(actor.modelMat);
+	for (int i = 0; i < ACTOR_BUFFER_COUNT; i++)
+		t3d_mat4fp_identity(&actor.modelMat[i]);
 
 	return actor;
 }
@@ -172,12 +185,27 @@ void actor_updateMat(Actor *actor)
 	if (actor->state == 9)
 		return; // DEATH
 
-	t3d_mat4fp_from_srt_euler(actor->modelMat,
+	actor->modelMatIdx = (actor->modelMatIdx + 1) % ACTOR_BUFFER_COUNT;
+	t3d_mat4fp_from_srt_euler(&actor->modelMat[actor->modelMatIdx],
 							  (float[3]){actor->scale.x, actor->scale.y, actor->scale.z},
 							  (float[3]){rad(actor->body.rotation.x), rad(actor->body.rotation.y), rad(actor->body.rotation.z)},
 							  (float[3]){actor->body.position.x, actor->body.position.y, actor->body.position.z});
 }
 
+// Writes the bones into the next buffer, the RSP can keep reading the previous ones
+void actor_updateSkeleton(Actor *actor, const T3DViewport *viewport)
+{
+	if (actor->state == 9)
+		return; // DEATH
+
+	T3DVec3 position = {{actor->body.position.x, actor->body.position.y, actor->body.position.z}};
+	if (!t3d_frustum_vs_sphere(&viewport->viewFrustum, &position, ACTOR_CULL_RADIUS))
+		return;
+
+	t3d_skeleton_use_next_buffer(&actor->armature.main);
+	t3d_skeleton_update(&actor->armature.main);
+}
+
 void actor_draw(Actor *actor)
 {
 	for (uint8_t i = 0; i < ACTOR_COUNT; i++)
@@ -186,6 +214,8 @@ void actor_draw(Actor *actor)
 		if (actor[i].state == 9)
 			continue; // DEATH
 
+		t3d_matrix_set(&actor[i].modelMat[actor[i].modelMatIdx], true);
+		t3d_segment_set(T3D_SEGMENT_SKELETON, actor[i].armature.main.boneMatricesFP);
 		rspq_block_run(actor[i].dl);
 	};
 }
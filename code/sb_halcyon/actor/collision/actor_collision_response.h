@@ -144,11 +144,10 @@ void actorCollision_collidePlatforms(Actor *actor, ActorContactData *actor_conta
 
     actorCollision_updateFalling(actor, actor_contact, actor_collider);
 
-    // Calculate the grid cell the actor is in
-    int xCell = (int)fm_floorf((actor->body.position.x + 775) / 350);
-    int yCell = (int)fm_floorf((actor->body.position.y + 775) / 350);
+    // Platforms the actor can touch from where it is
+    const int8_t *candidates = platform_getCandidates(&actor->body.position);
 
-    if (xCell < 0 || xCell >= 7 || yCell < 0 || yCell >= 7)
+    if (candidates == NULL)
     {
         // Actor is out of bounds; fall and skip collision
         actor->state = FALLING;
@@ -164,78 +163,57 @@ void actorCollision_collidePlatforms(Actor *actor, ActorContactData *actor_conta
     // Reset actor's collision state
     actor->hasCollided = false;
 
-    // Iterate through platforms in the same and adjacent cells
-    for (int dx = -1; dx <= 1; dx++)
+    // Iterate through the platform under the actor and its neighbours
+    for (int k = 0; k < PLATFORM_CANDIDATES && candidates[k] >= 0; k++)
     {
-        for (int dy = -1; dy <= 1; dy++)
+        Platform *platform = &platforms[candidates[k]];
+        fm_vec3_t actorPos = Vector3_to_fast(actor->body.position);
+        fm_vec3_t platformPos = Vector3_to_fast(platform->position);
+        float distanceSq = fm_vec3_distance2(&actorPos, &platformPos);
+        if (distanceSq <= collisionRangeSq)
         {
-            int nx = xCell + dx;
-            int ny = yCell + dy;
 
-            if (nx < 0 || nx >= 7 || ny < 0 || ny >= 7)
+            // Check collision with each box in the platform's collider
+            for (int j = 0; j < 3; j++)
             {
-                // Actor is out of bounds; fall and skip collision
-                actor->state = FALLING;
-                actor->grounded = false;
-                actor->grounding_height = LOWER_LIMIT_HEIGHT;
-                if (actor->body.position.z <= DEATH_PLANE_HEIGHT)
-                    actorState_setDeath(actor);
-                continue;
-            }
+                Box *box = &platform->collider.box[j];
 
-            PlatformGridCell *cell = &platformGrid[nx][ny];
-            for (size_t i = 0; i < cell->count; i++)
-            {
-                Platform *platform = &platforms[cell->platformIndices[i]];
-                fm_vec3_t actorPos = Vector3_to_fast(actor->body.position);
-                fm_vec3_t platformPos = Vector3_to_fast(platform->position);
-                float distanceSq = fm_vec3_distance2(&actorPos, &platformPos);
-                if (distanceSq <= collisionRangeSq)
+                // If the actor hits a box
+                if (actorCollision_contactBox(actor_collider, box))
                 {
+                    // Set collision response
+                    actorCollision_contactBoxSetData(actor_contact, actor_collider, box);
+                    actorCollision_collideAndSlide(actor, actor_contact);
+                    actorCollision_setGroundResponse(actor, actor_contact, actor_collider);
+
+                    // If the actor is lower the top of the box (center.z+(size.z/2)), move there
+                    if (actor->body.position.z < box->center.z + (box->size.z * 0.5f))
+                        actor->body.position.z = box->center.z + (box->size.z * 0.5f);
 
-                    // Check collision with each box in the platform's collider
-                    for (int j = 0; j < 3; j++)
+                    // Set collided state parameter
+                    actor->hasCollided = true;
+
+                    // Handle platform collision here instead again for the platforms
+                    platform->contact = true;
+                    platform->colorID = actor->colorID;
+
+                    switch (actor->colorID)
                     {
-                        Box *box = &platform->collider.box[j];
-
-                        // If the actor hits a box
-                        if (actorCollision_contactBox(actor_collider, box))
-                        {
-                            // Set collision response
-                            actorCollision_contactBoxSetData(actor_contact, actor_collider, box);
-                            actorCollision_collideAndSlide(actor, actor_contact);
-                            actorCollision_setGroundResponse(actor, actor_contact, actor_collider);
-
-                            // If the actor is lower the top of the box (center.z+(size.z/2)), move there
-                            if (actor->body.position.z < box->center.z + (box->size.z * 0.5f))
-                                actor->body.position.z = box->center.z + (box->size.z * 0.5f);
-
-                            // Set collided state parameter
-                            actor->hasCollided = true;
-
-                            // Handle platform collision here instead again for the platforms
-                            platform->contact = true;
-                            platform->colorID = actor->colorID;
-
-                            switch (actor->colorID)
-                            {
-                            case 0:
-                                platform->color = PLAYERCOLOR_1;
-                                break;
-                            case 1:
-                                platform->color = PLAYERCOLOR_2;
-                                break;
-                            case 2:
-                                platform->color = PLAYERCOLOR_3;
-                                break;
-                            case 3:
-                                platform->color = PLAYERCOLOR_4;
-                                break;
-                            }
-
-                            return; // Early exit if collision is detected
-                        }
+                    case 0:
+                        platform->color = PLAYERCOLOR_1;
+                        break;
+                    case 1:
+                        platform->color = PLAYERCOLOR_2;
+                        break;
+                    case 2:
+                        platform->color = PLAYERCOLOR_3;
+                        break;
+                    case 3:
+                        platform->color = PLAYERCOLOR_4;
+                        break;
                     }
+
+                    return; // Early exit if collision is detected
                 }
             }
         }
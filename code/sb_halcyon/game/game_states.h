@@ -125,8 +125,6 @@ void gameState_setIntro(Game *game, Player *player, Scenery *scenery)
 
 	t3d_matrix_pop(1);
 
-	game->syncPoint = rspq_syncpoint_new();
-
 	ui_intro(&player[0].control);
 
 	if (player[0].control.held.r)
@@ -168,8 +166,6 @@ void gameState_setMainMenu(Game *game, Player *player, Actor *actor, Scenery *sc
 
 	t3d_matrix_pop(1);
 
-	game->syncPoint = rspq_syncpoint_new();
-
 	if (core_get_playercount() == 4)
 	{
 		if (player[0].control.pressed.b)
@@ -291,7 +287,7 @@ void gameState_setCS(Game *game, Player *player, Actor *actor, Scenery *scenery)
 
 	for (size_t i = 0; i < ACTOR_COUNT; i++)
 	{
-		actor_update(&actor[i], NULL, &game->timing, game->scene.camera.angle_around_barycenter, game->scene.camera.offset_angle, &game->syncPoint);
+		actor_update(&actor[i], NULL, &game->timing, game->scene.camera.angle_around_barycenter, game->scene.camera.offset_angle);
 
 		// Reset non-selected actors
 		if (!actorSelected[i])
@@ -303,12 +299,10 @@ void gameState_setCS(Game *game, Player *player, Actor *actor, Scenery *scenery)
 		actor_updateMat(&actor[i]);
 	}
 
-	// Sync RSPQ once, and then update each actors' skeleton
-	if (game->syncPoint)
-		rspq_syncpoint_wait(game->syncPoint);
+	// Update each actors' skeleton, no need to wait for the RSP since every frame writes to a new buffer
 	for (size_t i = 0; i < ACTOR_COUNT; i++)
 	{
-		t3d_skeleton_update(&actor[i].armature.main);
+		actor_updateSkeleton(&actor[i], &game->screen.gameplay_viewport);
 	}
 
 	move_cloud(scenery);
@@ -343,8 +337,6 @@ void gameState_setCS(Game *game, Player *player, Actor *actor, Scenery *scenery)
 
 	t3d_matrix_pop(1);
 
-	game->syncPoint = rspq_syncpoint_new();
-
 	if (activePlayer < MAXPLAYERS)
 	{
 		player[activePlayer].position.x = (actor[selectedCharacter[activePlayer]].body.position.x * 3.6f) - 30.0f;
@@ -421,8 +413,6 @@ void gameState_setGameplay(Game *game, Player *player, AI *ai, Actor *actor, Sce
 
 		t3d_matrix_pop(1);
 
-		game->syncPoint = rspq_syncpoint_new();
-
 		// Convert frames to seconds based on refresh rate
 		uint8_t secondsLeft = (game->countdownTimer / display_get_refresh_rate()) + 1;
 		ui_countdown(secondsLeft);
@@ -500,7 +490,7 @@ void gameState_setGameplay(Game *game, Player *player, AI *ai, Actor *actor, Sce
 				aliveCount++;
 				lastAlivePlayer = i; // Track the last alive player
 				// Update the assigned actor using its actor ID
-				actor_update(currentActor, &player[i].control, &game->timing, game->scene.camera.angle_around_barycenter, game->scene.camera.offset_angle, &game->syncPoint);
+				actor_update(currentActor, &player[i].control, &game->timing, game->scene.camera.angle_around_barycenter, game->scene.camera.offset_angle);
 				// Update collision data for the assigned actor
 				actorCollision_collidePlatforms(currentActor, &actor_contact[actorIndex], &actor_collider[actorIndex], hexagons);
 
@@ -616,12 +606,10 @@ void gameState_setGameplay(Game *game, Player *player, AI *ai, Actor *actor, Sce
 		game->winnerSet = true;
 	}
 
-	// Sync RSPQ once, and then update each actors' skeleton
-	if (game->syncPoint)
-		rspq_syncpoint_wait(game->syncPoint);
+	// Update each actors' skeleton, no need to wait for the RSP since every frame writes to a new buffer
 	for (size_t i = 0; i < ACTOR_COUNT; i++)
 	{
-		t3d_skeleton_update(&actor[i].armature.main);
+		actor_updateSkeleton(&actor[i], &game->screen.gameplay_viewport);
 	}
 
 	// ======== Draw ======== //
@@ -660,8 +648,6 @@ void gameState_setGameplay(Game *game, Player *player, AI *ai, Actor *actor, Sce
 
 	t3d_matrix_pop(1);
 
-	game->syncPoint = rspq_syncpoint_new();
-
 	// TPX
 	ptx_draw(&game->screen.gameplay_viewport, &hexagons[0], &cloudMist);
 	ptx_draw(&game->screen.gameplay_viewport, &hexagons[4], &cloudMist);
@@ -760,8 +746,6 @@ void gameState_setPause(Game *game, Player *player, Actor *actor, Scenery *scene
 
 	t3d_matrix_pop(1);
 
-	game->syncPoint = rspq_syncpoint_new();
-
 	if (player[0].control.held.r)
 	{
 		ui_fps(game->timing.frame_rate, 20.0f, 20.0f);
@@ -36,6 +36,21 @@ typedef struct
 
 PlatformGridCell platformGrid[MAX_GRID_CELLS][MAX_GRID_CELLS];
 
+#define PLATFORM_BUCKET_SIZE (OFFSET / 4.0f) // Small enough that a bucket's nearest platform and its neighbours cover everything in reach
+#define PLATFORM_BUCKET_MAX 32            // Buckets per side
+#define PLATFORM_NEIGHBOUR_RANGE (OFFSET * 1.25f)
+#define PLATFORM_CANDIDATES 7             // A hexagon and its 6 neighbours
+
+typedef struct
+{
+  float minX, minY; // Bounds of the level, taken from the platforms
+  int columns, rows;
+  int8_t platform[PLATFORM_BUCKET_MAX][PLATFORM_BUCKET_MAX]; // Nearest platform to each bucket, -1 if none in reach
+  int8_t candidates[PLATFORM_COUNT][PLATFORM_CANDIDATES];    // Each platform followed by its neighbours, -1 padded
+} PlatformBuckets;
+
+PlatformBuckets platformBuckets;
+
 Platform hexagons[PLATFORM_COUNT];
 
 Platform innerRing[6];
@@ -108,6 +123,85 @@ void platform_assignGrid(Platform *platforms)
   }
 }
 
+// Build the static bucket table from the platforms' home positions
+void platform_buildBuckets(Platform *platforms)
+{
+  PlatformBuckets *buckets = &platformBuckets;
+  float maxX = platforms[0].home.x, maxY = platforms[0].home.y;
+
+  buckets->minX = platforms[0].home.x;
+  buckets->minY = platforms[0].home.y;
+  for (size_t i = 1; i < PLATFORM_COUNT; i++)
+  {
+    buckets->minX = fminf(buckets->minX, platforms[i].home.x);
+    buckets->minY = fminf(buckets->minY, platforms[i].home.y);
+    maxX = fmaxf(maxX, platforms[i].home.x);
+    maxY = fmaxf(maxY, platforms[i].home.y);
+  }
+
+  // Pad by a platform so the edges are covered too
+  buckets->minX -= OFFSET;
+  buckets->minY -= OFFSET;
+  buckets->columns = (int)ceilf((maxX + OFFSET - buckets->minX) / PLATFORM_BUCKET_SIZE);
+  buckets->rows = (int)ceilf((maxY + OFFSET - buckets->minY) / PLATFORM_BUCKET_SIZE);
+  if (buckets->columns > PLATFORM_BUCKET_MAX)
+    buckets->columns = PLATFORM_BUCKET_MAX;
+  if (buckets->rows > PLATFORM_BUCKET_MAX)
+    buckets->rows = PLATFORM_BUCKET_MAX;
+
+  // Nearest platform to the center of each bucket
+  for (int x = 0; x < buckets->columns; x++)
+  {
+    for (int y = 0; y < buckets->rows; y++)
+    {
+      float centerX = buckets->minX + (x + 0.5f) * PLATFORM_BUCKET_SIZE;
+      float centerY = buckets->minY + (y + 0.5f) * PLATFORM_BUCKET_SIZE;
+      float nearestSq = OFFSET * OFFSET;
+      buckets->platform[x][y] = -1;
+      for (size_t i = 0; i < PLATFORM_COUNT; i++)
+      {
+        float dx = platforms[i].home.x - centerX;
+        float dy = platforms[i].home.y - centerY;
+        if (dx * dx + dy * dy < nearestSq)
+        {
+          nearestSq = dx * dx + dy * dy;
+          buckets->platform[x][y] = i;
+        }
+      }
+    }
+  }
+
+  // Each platform and the hexagons around it
+  const float neighbourRangeSq = PLATFORM_NEIGHBOUR_RANGE * PLATFORM_NEIGHBOUR_RANGE;
+  for (size_t i = 0; i < PLATFORM_COUNT; i++)
+  {
+    int count = 0;
+    buckets->candidates[i][count++] = i;
+    for (size_t j = 0; j < PLATFORM_COUNT && count < PLATFORM_CANDIDATES; j++)
+    {
+      float dx = platforms[j].home.x - platforms[i].home.x;
+      float dy = platforms[j].home.y - platforms[i].home.y;
+      if (j != i && dx * dx + dy * dy <= neighbourRangeSq)
+        buckets->candidates[i][count++] = j;
+    }
+    while (count < PLATFORM_CANDIDATES)
+      buckets->candidates[i][count++] = -1;
+  }
+}
+
+// Platforms that can be touched from a position, or NULL if the position is off the level
+const int8_t *platform_getCandidates(const Vector3 *position)
+{
+  const PlatformBuckets *buckets = &platformBuckets;
+  int x = (int)fm_floorf((position->x - buckets->minX) / PLATFORM_BUCKET_SIZE);
+  int y = (int)fm_floorf((position->y - buckets->minY) / PLATFORM_BUCKET_SIZE);
+
+  if (x < 0 || x >= buckets->columns || y < 0 || y >= buckets->rows || buckets->platform[x][y] < 0)
+    return NULL;
+
+  return buckets->candidates[buckets->platform[x][y]];
+}
+
 //// BEHAVIORS ~ Start ////
 
 // Example behavior: Oscillate platform x position to simulate shake
@@ -180,38 +274,21 @@ void platform_collideCheck(Platform *platform, Actor *actor)
 
 void platform_collideCheckOptimized(Platform *platforms, Actor *actor)
 {
-  int xCell = (int)floorf((actor->body.position.x + (OFFSET * 2)) / GRID_SIZE);
-  int yCell = (int)floorf((actor->body.position.y + (OFFSET * 2)) / GRID_SIZE);
-
-  if (xCell < 0 || xCell >= MAX_GRID_CELLS || yCell < 0 || yCell >= MAX_GRID_CELLS)
-  {
+  const int8_t *candidates = platform_getCandidates(&actor->body.position);
+  if (candidates == NULL)
     return; // Actor is out of bounds
-  }
 
   const float collisionRangeSq = 150.0f * 150.0f;
 
-  // Check platforms in the same and adjacent cells
-  for (int dx = -1; dx <= 1; dx++)
+  // Check the platform under the actor and its neighbours
+  for (int i = 0; i < PLATFORM_CANDIDATES && candidates[i] >= 0; i++)
   {
-    for (int dy = -1; dy <= 1; dy++)
+    Platform *platform = &platforms[candidates[i]];
+    float distanceSq = vector3_squaredDistance(&actor->body.position, &platform->position);
+    if (distanceSq <= collisionRangeSq)
     {
-      int nx = xCell + dx;
-      int ny = yCell + dy;
-
-      if (nx >= 0 && nx < MAX_GRID_CELLS && ny >= 0 && ny < MAX_GRID_CELLS)
-      {
-        PlatformGridCell *cell = &platformGrid[nx][ny];
-        for (size_t i = 0; i < cell->count; i++)
-        {
-          size_t platformIndex = cell->platformIndices[i];
-          float distanceSq = vector3_squaredDistance(&actor->body.position, &platforms[platformIndex].position);
-          if (distanceSq <= collisionRangeSq)
-          {
-            platforms[platformIndex].contact = true;
-            return; // Early exit on collision
-          }
-        }
-      }
+      platform->contact = true;
+      return; // Early exit on collision
     }
   }
 }
@@ -368,6 +445,7 @@ void platform_hexagonGrid(Platform *platform, T3DModel *model, float z, color_t
   }
 
   platform_assignGrid(platform);
+  platform_buildBuckets(platform);
 
   // Assign platforms to ring by predefined IDs
   for (int g = 0; g < sizeof(innerRingID) / sizeof(innerRingID[0]); g++)
@@ -2,6 +2,7 @@
 #define SOUND_H
 
 #include <libdragon.h>
+#include "../../../assetcache.h"
 
 // Core Definitions
 #define MUSIC_CHANNEL 0
@@ -33,8 +34,9 @@ enum SFX_WAV
     NUM_WAV
 };
 
-// Each WAV must have its own structure
-wav64_t soundEffects[NUM_WAV];
+// Each WAV must have its own structure, the core ones (SFX_START onwards) are shared through the asset cache
+wav64_t soundStorage[NUM_WAV];
+wav64_t *soundEffects[NUM_WAV];
 
 const char *wavFileNames[NUM_WAV] = {
     "rom:/strawberry_byte/sound/grunt-01.wav64",
@@ -63,7 +65,17 @@ void sound_load(void)
 {
     // Open all WAVs at boot
     for (int w = 0; w < NUM_WAV; ++w)
-        wav64_open(&soundEffects[w], wavFileNames[w]);
+    {
+        if (w >= SFX_START)
+        {
+            soundEffects[w] = assetcache_get_sound(wavFileNames[w]);
+        }
+        else
+        {
+            wav64_open(&soundStorage[w], wavFileNames[w]);
+            soundEffects[w] = &soundStorage[w];
+        }
+    }
 
     // Open and play first XM in the list
     xm64player_open(&xmPlayer, xmFileNames[0]);
@@ -98,19 +110,22 @@ void sound_xmUpdate(float volume, bool loop)
 // Plays requested WAV and whether to loop
 void sound_wavPlay(int sfxID, bool loop)
 {
-    wav64_set_loop(&soundEffects[sfxID], loop);
-    wav64_play(&soundEffects[sfxID], SFX_CHANNEL - sfxID);
+    wav64_set_loop(soundEffects[sfxID], loop);
+    wav64_play(soundEffects[sfxID], SFX_CHANNEL - sfxID);
 }
 
 void sound_wavClose(int sfxID)
 {
-    wav64_close(&soundEffects[sfxID]);
+    if (sfxID >= SFX_START)
+        assetcache_release_sound(soundEffects[sfxID]);
+    else
+        wav64_close(soundEffects[sfxID]);
 }
 
 void sound_wavCleanup(void)
 {
     for (int w = 0; w < NUM_WAV; ++w)
-        wav64_close(&soundEffects[w]);
+        sound_wavClose(w);
 }
 
 void sound_cleanup(void)
@@ -63,7 +63,6 @@ void generate_grid(void)
 void object_init(object_data *object, uint8_t objectType, uint8_t ID, T3DVec3 position)
 {
   object->ID = ID;
-  object->mtxFP = malloc_uncached(sizeof(T3DMat4FP));
   object->position = position;
   object->texID = 0;
 
@@ -128,29 +127,17 @@ void object_initBatch(object_type *batch, uint8_t objectType)
     object_init(&batch->objects[i], batch->type, i, gridPos[i]);
   }
 
-  // Create model block
+  // Create instance batch, buildings pick their material at draw time
   if (objectType == OBJ_BUILDING)
   {
-    for (size_t i = 0; i < NUM_OBJECTS; i++)
-    {
-      rspq_block_begin();
-      t3d_matrix_set(batch->objects[i].mtxFP, true);
-      t3d_model_draw_object(buildings[0], NULL);
-
-      batch->objects[i].modelBlock = rspq_block_end();
-    }
+    instancing_init(&batch->instances, batch->model, buildings[0], NUM_OBJECTS, false);
   }
   else
   {
+    instancing_init(&batch->instances, batch->model, NULL, NUM_OBJECTS, true);
     for (size_t i = 0; i < NUM_OBJECTS; i++)
     {
-      rspq_block_begin();
-
-      t3d_matrix_set(batch->objects[i].mtxFP, true);
-      rdpq_set_prim_color(batch->objects[i].color);
-      t3d_model_draw(batch->model);
-
-      batch->objects[i].modelBlock = rspq_block_end();
+      instancing_set_color(&batch->instances, i, batch->objects[i].color);
     }
   }
 }
@@ -260,9 +247,10 @@ void object_updateBatch(object_type *batch, T3DViewport *vp, player_data *player
       }
     }
 
-    // Update matrices
-    t3d_mat4fp_from_srt_euler(
-        batch->objects[i].mtxFP,
+    // Update matrices, only uploaded if the object has changed
+    instancing_set_transform(
+        &batch->instances,
+        i,
         batch->objects[i].scale.v,
         (float[3]){0, batch->objects[i].yaw, 0},
         batch->objects[i].position.v);
@@ -271,36 +259,31 @@ void object_updateBatch(object_type *batch, T3DViewport *vp, player_data *player
 
 void object_drawBatch(object_type *batch)
 {
+  for (size_t i = 0; i < NUM_OBJECTS; i++)
+  {
+    instancing_set_visible(&batch->instances, i, batch->objects[i].visible && !batch->objects[i].hide);
+  }
+
   if (batch->type == OBJ_BUILDING)
   {
+    // Buildings flicker independently by swapping materials, so draw each material's buildings together
     for (size_t i = 0; i < NUM_OBJECTS; i++)
     {
-      // For the buildings we draw a material and object for each to allow each to flicker independently
-      t3d_model_draw_material(buildings[batch->objects[i].texID]->material, NULL);
-      if (batch->objects[i].visible && !batch->objects[i].hide)
-      {
-        rspq_block_run(batch->objects[i].modelBlock);
-      }
+      instancing_set_group(&batch->instances, i, batch->objects[i].texID);
     }
+    instancing_draw_group(&batch->instances, NULL, 0, buildings[0]->material);
+    instancing_draw_group(&batch->instances, NULL, 1, buildings[1]->material);
   }
   else
   {
-    for (size_t i = 0; i < NUM_OBJECTS; i++)
-    {
-      if (batch->objects[i].visible && !batch->objects[i].hide)
-        rspq_block_run(batch->objects[i].modelBlock);
-    }
+    instancing_draw(&batch->instances, NULL);
   }
   rspq_wait(); // RSPQ crashes if we don't wait for the objects to finish
 }
 
 void object_destroyBatch(object_type *batch)
 {
-  for (size_t i = 0; i < NUM_OBJECTS; i++)
-  {
-    free_uncached(batch->objects[i].mtxFP);
-    rspq_block_free(batch->objects[i].modelBlock);
-  }
+  instancing_free(&batch->instances);
 
   t3d_model_free(batch->model);
 }
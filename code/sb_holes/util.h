@@ -45,14 +45,12 @@ typedef struct
   uint8_t ID;
   uint8_t texID;
   T3DObject *model;
-  T3DMat4FP *mtxFP;
   T3DVec3 position;
   T3DVec3 scale;
   float yaw;
   bool visible;
   bool hide;
   color_t color;
-  rspq_block_t *modelBlock;
 } object_data;
 
 typedef struct
@@ -62,6 +60,7 @@ typedef struct
   T3DModel *model;
   float collisionRadius;
   object_data objects[NUM_OBJECTS];
+  InstanceBatch instances;
 } object_type;
 
 typedef struct
@@ -34,12 +34,12 @@ void actorAnimation_init(const Actor *actor, ActorAnimation *animation)
 	// t3d_anim_attach(&animation->blend.running_left, &actor->armature.blend);
 }
 
-void actorAnimation_setStandIdle(Actor *actor, ActorAnimation *animation, const float frame_time, rspq_syncpoint_t *syncpoint)
+void actorAnimation_setStandIdle(Actor *actor, ActorAnimation *animation, const float frame_time)
 {
 	t3d_anim_update(&animation->main.breathing_idle, frame_time);
 }
 
-void actorAnimation_setRunning(Actor *actor, ActorAnimation *animation, const float frame_time, rspq_syncpoint_t *syncpoint)
+void actorAnimation_setRunning(Actor *actor, ActorAnimation *animation, const float frame_time)
 {
 	// if (animation->previous == STAND_IDLE || animation->current == STAND_IDLE) {
 	//	animation->blending_ratio = actor->horizontal_speed / 320;
@@ -58,19 +58,19 @@ void actorAnimation_setRunning(Actor *actor, ActorAnimation *animation, const fl
 	t3d_anim_update(&animation->main.running_left, frame_time);
 }
 
-void actorAnimation_setJump(Actor *actor, ActorAnimation *animation, const float frame_time, rspq_syncpoint_t *syncpoint)
+void actorAnimation_setJump(Actor *actor, ActorAnimation *animation, const float frame_time)
 {
 	t3d_anim_update(&animation->main.falling_left, frame_time);
 }
 
-void actor_setAnimation(Actor *actor, ActorAnimation *animation, const float frame_time, rspq_syncpoint_t *syncpoint)
+void actor_setAnimation(Actor *actor, ActorAnimation *animation, const float frame_time)
 {
 	switch (actor->state)
 	{
 
 	case STAND_IDLE:
 	{
-		actorAnimation_setStandIdle(actor, animation, frame_time, syncpoint);
+		actorAnimation_setStandIdle(actor, animation, frame_time);
 		if (animation->current != STAND_IDLE)
 		{
 			animation->previous = animation->current;
@@ -81,7 +81,7 @@ void actor_setAnimation(Actor *actor, ActorAnimation *animation, const float fra
 
 	case RUNNING:
 	{
-		actorAnimation_setRunning(actor, animation, frame_time, syncpoint);
+		actorAnimation_setRunning(actor, animation, frame_time);
 		if (animation->current != RUNNING)
 		{
 			animation->previous = animation->current;
@@ -92,29 +92,20 @@ void actor_setAnimation(Actor *actor, ActorAnimation *animation, const float fra
 
 	case JUMP:
 	{
-		actorAnimation_setJump(actor, animation, frame_time, syncpoint);
+		actorAnimation_setJump(actor, animation, frame_time);
 		break;
 	}
 	case FALLING:
 	{
-		actorAnimation_setJump(actor, animation, frame_time, syncpoint);
+		actorAnimation_setJump(actor, animation, frame_time);
 		break;
 	}
 	case DEATH:
 	{
-		actorAnimation_setJump(actor, animation, frame_time, syncpoint);
+		actorAnimation_setJump(actor, animation, frame_time);
 		break;
 	}
 	}
-
-	/*
-	 * The original engine only accounts for 1 actor,
-	 * but looping through the actor update for each
-	 * means that the syncpoint would be updated
-	 * 4 times, which is 3 too many.
-	 */
-	// if(syncpoint)rspq_syncpoint_wait(*syncpoint);
-	// t3d_skeleton_update(&actor->armature.main);
 }
 
 // temporary place for this until i solve the circular dependency
@@ -124,13 +115,13 @@ void actor_init(Actor *actor)
 	actorAnimation_init(actor, &actor->animation);
 }
 
-void actor_update(Actor *actor, ControllerData *control, TimeData *timing, float camera_angle_around, float camera_offset, rspq_syncpoint_t *syncpoint)
+void actor_update(Actor *actor, ControllerData *control, TimeData *timing, float camera_angle_around, float camera_offset)
 {
 	if (control != NULL)
 		actor_setControlData(actor, control, timing->frame_time_s, camera_angle_around, camera_offset);
 	if (actor->previous_state != actor->state)
 		actor_setState(actor, actor->state); // Skip setting state if it hasn't changed
-	actor_setAnimation(actor, &actor->animation, timing->frame_time_s, syncpoint);
+	actor_setAnimation(actor, &actor->animation, timing->frame_time_s);
 	actor_setMotion(actor, timing->fixed_time_s);
 }
 
@@ -17,7 +17,6 @@ typedef struct
 	uint8_t state;
 	Screen screen;
 	TimeData timing;
-	rspq_syncpoint_t syncPoint;
 	int diff;
 	int8_t winTimer;
 	uint8_t winnerID;
@@ -53,7 +52,6 @@ void game_init(Game *game)
 	//
 
 	game->countdownTimer = 150; // Oops, forget to set this
-	game->syncPoint = 0;
 	game->state = INTRO;
 	game->humanCount = core_get_playercount();
 	game->deadPool = 0;
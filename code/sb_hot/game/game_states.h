@@ -86,8 +86,6 @@ void gameState_setIntro(Game *game, Player *player, Scenery *scenery)
 
 	t3d_matrix_pop(1);
 
-	game->syncPoint = rspq_syncpoint_new();
-
 	// TPX
 	ptx_draw(&game->screen.gameplay_viewport, &lavaBubbles, 1, 1);
 
@@ -128,8 +126,6 @@ void gameState_setMainMenu(Game *game, Player *player, Actor *actor, Scenery *sc
 
 	t3d_matrix_pop(1);
 
-	game->syncPoint = rspq_syncpoint_new();
-
 	// TPX
 	ptx_draw(&game->screen.gameplay_viewport, &lavaBubbles, 1, 1);
 
@@ -254,7 +250,7 @@ void gameState_setCS(Game *game, Player *player, Actor *actor, Scenery *scenery)
 
 	for (size_t i = 0; i < ACTOR_COUNT; i++)
 	{
-		actor_update(&actor[i], NULL, &game->timing, game->scene.camera.angle_around_barycenter, game->scene.camera.offset_angle, &game->syncPoint);
+		actor_update(&actor[i], NULL, &game->timing, game->scene.camera.angle_around_barycenter, game->scene.camera.offset_angle);
 
 		// Reset non-selected actors
 		if (!actorSelected[i])
@@ -266,12 +262,10 @@ void gameState_setCS(Game *game, Player *player, Actor *actor, Scenery *scenery)
 		actor_updateMat(&actor[i]);
 	}
 
-	// Sync RSPQ once, and then update each actors' skeleton
-	if (game->syncPoint)
-		rspq_syncpoint_wait(game->syncPoint);
+	// Update each actors' skeleton, no need to wait for the RSP since every frame writes to a new buffer
 	for (size_t i = 0; i < ACTOR_COUNT; i++)
 	{
-		t3d_skeleton_update(&actor[i].armature.main);
+		actor_updateSkeleton(&actor[i], &game->screen.gameplay_viewport);
 	}
 
 	move_lava(scenery);
@@ -303,8 +297,6 @@ void gameState_setCS(Game *game, Player *player, Actor *actor, Scenery *scenery)
 
 	t3d_matrix_pop(1);
 
-	game->syncPoint = rspq_syncpoint_new();
-
 	// TPX
 	lavaBubbles.count = 512;
 	ptx_draw(&game->screen.gameplay_viewport, &lavaBubbles, 1, 1);
@@ -379,8 +371,6 @@ void gameState_setGameplay(Game *game, Player *player, AI *ai, Actor *actor, Sce
 
 		t3d_matrix_pop(1);
 
-		game->syncPoint = rspq_syncpoint_new();
-
 		// TPX
 		ptx_draw(&game->screen.gameplay_viewport, &lavaBubbles, 1, 1);
 
@@ -446,7 +436,7 @@ void gameState_setGameplay(Game *game, Player *player, AI *ai, Actor *actor, Sce
 				aliveCount++;
 				lastAlivePlayer = i; // Track the last alive player
 				// Update the assigned actor using its actor ID
-				actor_update(currentActor, &player[i].control, &game->timing, game->scene.camera.angle_around_barycenter, game->scene.camera.offset_angle, &game->syncPoint);
+				actor_update(currentActor, &player[i].control, &game->timing, game->scene.camera.angle_around_barycenter, game->scene.camera.offset_angle);
 				// Update collision data for the assigned actor
 				actorCollision_collidePlatforms(currentActor, &actor_contact[actorIndex], &actor_collider[actorIndex], hexagons);
 
@@ -486,12 +476,10 @@ void gameState_setGameplay(Game *game, Player *player, AI *ai, Actor *actor, Sce
 		game->winnerSet = true;
 	}
 
-	// Sync RSPQ once, and then update each actors' skeleton
-	if (game->syncPoint)
-		rspq_syncpoint_wait(game->syncPoint);
+	// Update each actors' skeleton, no need to wait for the RSP since every frame writes to a new buffer
 	for (size_t i = 0; i < ACTOR_COUNT; i++)
 	{
-		t3d_skeleton_update(&actor[i].armature.main);
+		actor_updateSkeleton(&actor[i], &game->screen.gameplay_viewport);
 	}
 
 	// ======== Draw ======== //
@@ -526,8 +514,6 @@ void gameState_setGameplay(Game *game, Player *player, AI *ai, Actor *actor, Sce
 
 	t3d_matrix_pop(1);
 
-	game->syncPoint = rspq_syncpoint_new();
-
 	// TPX
 	if (!game->winnerSet)
 		ptx_draw(&game->screen.gameplay_viewport, &lavaBubbles, 1, 1);
@@ -625,8 +611,6 @@ void gameState_setPause(Game *game, Player *player, Actor *actor, Scenery *scene
 
 	t3d_matrix_pop(1);
 
-	game->syncPoint = rspq_syncpoint_new();
-
 	// TPX
 	ptx_draw(&game->screen.gameplay_viewport, &lavaBubbles, 1, 1);
 
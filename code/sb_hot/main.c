@@ -32,6 +32,7 @@
 
 #include "../../core.h"
 #include "../../minigame.h"
+#include "../../instancing.h"
 
 #include "screen/screen.h"
 #include "control/controls.h"
@@ -12,8 +12,6 @@ typedef struct
 {
 
   uint32_t id;
-  T3DMat4FP *mat;
-  T3DObject *obj;
   Vector3 position;
   Vector3 home;
   PlatformCollider collider;
@@ -35,7 +33,23 @@ typedef struct
 
 PlatformGridCell platformGrid[MAX_GRID_CELLS][MAX_GRID_CELLS];
 
+#define PLATFORM_BUCKET_SIZE (OFFSET / 4.0f) // Small enough that a bucket's nearest platform and its neighbours cover everything in reach
+#define PLATFORM_BUCKET_MAX 32            // Buckets per side
+#define PLATFORM_NEIGHBOUR_RANGE (OFFSET * 1.25f)
+#define PLATFORM_CANDIDATES 7             // A hexagon and its 6 neighbours
+
+typedef struct
+{
+  float minX, minY; // Bounds of the level, taken from the platforms
+  int columns, rows;
+  int8_t platform[PLATFORM_BUCKET_MAX][PLATFORM_BUCKET_MAX]; // Nearest platform to each bucket, -1 if none in reach
+  int8_t candidates[PLATFORM_COUNT][PLATFORM_CANDIDATES];    // Each platform followed by its neighbours, -1 padded
+} PlatformBuckets;
+
+PlatformBuckets platformBuckets;
+
 Platform hexagons[PLATFORM_COUNT];
+InstanceBatch platformBatch;
 
 // Forward Declarations
 
@@ -53,7 +67,6 @@ void platform_init(Platform *platform, T3DModel *model, Vector3 position, color_
   static uint32_t platformIdx = 0;
 
   platform->id = platformIdx;
-  platform->mat = malloc_uncached(sizeof(T3DMat4FP)); // needed for t3d
   platform->position = position;
   platform->home = position;
 
@@ -99,6 +112,85 @@ void platform_assignGrid(Platform *platforms)
   }
 }
 
+// Build the static bucket table from the platforms' home positions
+void platform_buildBuckets(Platform *platforms)
+{
+  PlatformBuckets *buckets = &platformBuckets;
+  float maxX = platforms[0].home.x, maxY = platforms[0].home.y;
+
+  buckets->minX = platforms[0].home.x;
+  buckets->minY = platforms[0].home.y;
+  for (size_t i = 1; i < PLATFORM_COUNT; i++)
+  {
+    buckets->minX = fminf(buckets->minX, platforms[i].home.x);
+    buckets->minY = fminf(buckets->minY, platforms[i].home.y);
+    maxX = fmaxf(maxX, platforms[i].home.x);
+    maxY = fmaxf(maxY, platforms[i].home.y);
+  }
+
+  // Pad by a platform so the edges are covered too
+  buckets->minX -= OFFSET;
+  buckets->minY -= OFFSET;
+  buckets->columns = (int)ceilf((maxX + OFFSET - buckets->minX) / PLATFORM_BUCKET_SIZE);
+  buckets->rows = (int)ceilf((maxY + OFFSET - buckets->minY) / PLATFORM_BUCKET_SIZE);
+  if (buckets->columns > PLATFORM_BUCKET_MAX)
+    buckets->columns = PLATFORM_BUCKET_MAX;
+  if (buckets->rows > PLATFORM_BUCKET_MAX)
+    buckets->rows = PLATFORM_BUCKET_MAX;
+
+  // Nearest platform to the center of each bucket
+  for (int x = 0; x < buckets->columns; x++)
+  {
+    for (int y = 0; y < buckets->rows; y++)
+    {
+      float centerX = buckets->minX + (x + 0.5f) * PLATFORM_BUCKET_SIZE;
+      float centerY = buckets->minY + (y + 0.5f) * PLATFORM_BUCKET_SIZE;
+      float nearestSq = OFFSET * OFFSET;
+      buckets->platform[x][y] = -1;
+      for (size_t i = 0; i < PLATFORM_COUNT; i++)
+      {
+        float dx = platforms[i].home.x - centerX;
+        float dy = platforms[i].home.y - centerY;
+        if (dx * dx + dy * dy < nearestSq)
+        {
+          nearestSq = dx * dx + dy * dy;
+          buckets->platform[x][y] = i;
+        }
+      }
+    }
+  }
+
+  // Each platform and the hexagons around it
+  const float neighbourRangeSq = PLATFORM_NEIGHBOUR_RANGE * PLATFORM_NEIGHBOUR_RANGE;
+  for (size_t i = 0; i < PLATFORM_COUNT; i++)
+  {
+    int count = 0;
+    buckets->candidates[i][count++] = i;
+    for (size_t j = 0; j < PLATFORM_COUNT && count < PLATFORM_CANDIDATES; j++)
+    {
+      float dx = platforms[j].home.x - platforms[i].home.x;
+      float dy = platforms[j].home.y - platforms[i].home.y;
+      if (j != i && dx * dx + dy * dy <= neighbourRangeSq)
+        buckets->candidates[i][count++] = j;
+    }
+    while (count < PLATFORM_CANDIDATES)
+      buckets->candidates[i][count++] = -1;
+  }
+}
+
+// Platforms that can be touched from a position, or NULL if the position is off the level
+const int8_t *platform_getCandidates(const Vector3 *position)
+{
+  const PlatformBuckets *buckets = &platformBuckets;
+  int x = (int)fm_floorf((position->x - buckets->minX) / PLATFORM_BUCKET_SIZE);
+  int y = (int)fm_floorf((position->y - buckets->minY) / PLATFORM_BUCKET_SIZE);
+
+  if (x < 0 || x >= buckets->columns || y < 0 || y >= buckets->rows || buckets->platform[x][y] < 0)
+    return NULL;
+
+  return buckets->candidates[buckets->platform[x][y]];
+}
+
 //// BEHAVIORS ~ Start ////
 
 // Example behavior: Oscillate platform x position to simulate shake
@@ -147,38 +239,21 @@ void platform_collideCheck(Platform *platform, Actor *actor)
 
 void platform_collideCheckOptimized(Platform *platforms, Actor *actor)
 {
-  int xCell = (int)floorf((actor->body.position.x + (OFFSET * 2)) / GRID_SIZE);
-  int yCell = (int)floorf((actor->body.position.y + (OFFSET * 2)) / GRID_SIZE);
-
-  if (xCell < 0 || xCell >= MAX_GRID_CELLS || yCell < 0 || yCell >= MAX_GRID_CELLS)
-  {
+  const int8_t *candidates = platform_getCandidates(&actor->body.position);
+  if (candidates == NULL)
     return; // Actor is out of bounds
-  }
 
   const float collisionRangeSq = 150.0f * 150.0f;
 
-  // Check platforms in the same and adjacent cells
-  for (int dx = -1; dx <= 1; dx++)
+  // Check the platform under the actor and its neighbours
+  for (int i = 0; i < PLATFORM_CANDIDATES && candidates[i] >= 0; i++)
   {
-    for (int dy = -1; dy <= 1; dy++)
+    Platform *platform = &platforms[candidates[i]];
+    float distanceSq = vector3_squaredDistance(&actor->body.position, &platform->position);
+    if (distanceSq <= collisionRangeSq)
     {
-      int nx = xCell + dx;
-      int ny = yCell + dy;
-
-      if (nx >= 0 && nx < MAX_GRID_CELLS && ny >= 0 && ny < MAX_GRID_CELLS)
-      {
-        PlatformGridCell *cell = &platformGrid[nx][ny];
-        for (size_t i = 0; i < cell->count; i++)
-        {
-          size_t platformIndex = cell->platformIndices[i];
-          float distanceSq = vector3_squaredDistance(&actor->body.position, &platforms[platformIndex].position);
-          if (distanceSq <= collisionRangeSq)
-          {
-            platforms[platformIndex].contact = true;
-            return; // Early exit on collision
-          }
-        }
-      }
+      platform->contact = true;
+      return; // Early exit on collision
     }
   }
 }
@@ -230,9 +305,10 @@ void platform_loop(Platform *platform, Actor *actor, int diff)
       platform->position.z = platform->position.z + 1.0f + difficulty;
   }
 
-  // Update matrix
-  t3d_mat4fp_from_srt_euler(
-      platform->mat,
+  // Update matrix, only uploaded if the platform has moved
+  instancing_set_transform(
+      &platformBatch,
+      platform->id,
       (float[3]){1.0f, 1.0f, 1.0f},
       (float[3]){0.0f, 0.0f, 0.0f},
       (float[3]){platform->position.x, platform->position.y, platform->position.z});
@@ -243,69 +319,35 @@ void platform_loop(Platform *platform, Actor *actor, int diff)
 //// RENDERING ~ Start ////
 
 // T3D MODEL DRAW BATCHING
-#define BATCH_LIMIT 19 // Number of objects per rspq block
-#define BLOCK_COUNT 1  // Pre-calculated block count
 
 T3DModel *batchModel = NULL;
-rspq_block_t *rspqBlocks[BLOCK_COUNT] = {NULL}; // Static array of rspq block pointers
-rspq_block_t *materialBlock = NULL;             // Block for single material load and draw
 
 void platform_createBatch(Platform *platform, T3DModel *model)
 {
-  // Load model once for the entire batch if not already loaded
-  if (batchModel == NULL)
-  {
-    batchModel = model;
-  }
-
-  // Create T3DObjects from batch for each platform
-  for (size_t i = 0; i < PLATFORM_COUNT; i++)
-  {
-    platform[i].obj = t3d_model_get_object_by_index(batchModel, 0);
-  }
-
-  // Create material RSPQ block to run before drawing objects
-  rspq_block_begin();
-  t3d_model_draw_material(platform[0].obj->material, NULL);
-  materialBlock = rspq_block_end();
+  batchModel = model;
 
-  // Initialize the rspq block index and start a new rspq block
-  size_t blockIndex = 0;
-  rspq_block_begin();
+  // One material load for all platforms, then a matrix, color and object draw each
+  instancing_init(&platformBatch, batchModel, t3d_model_get_object_by_index(batchModel, 0), PLATFORM_COUNT, true);
 
   for (size_t i = 0; i < PLATFORM_COUNT; i++)
   {
-
-    // Set the model matrix and draw
-    t3d_matrix_set(platform[i].mat, true);
-    rdpq_set_prim_color(platform[i].color);
-    t3d_model_draw_object(platform[i].obj, NULL);
-
-    // End the current rspq block and start a new one every n objects
-    if ((i + 1) % BATCH_LIMIT == 0 || i == PLATFORM_COUNT - 1)
-    {
-      rspqBlocks[blockIndex] = rspq_block_end(); // Store the completed rspq block
-      blockIndex++;
-      if (i < PLATFORM_COUNT - 1)
-        rspq_block_begin(); // Start a new rspq block if more objects remain
-    }
+    instancing_set_transform(
+        &platformBatch,
+        platform[i].id,
+        (float[3]){1.0f, 1.0f, 1.0f},
+        (float[3]){0.0f, 0.0f, 0.0f},
+        (float[3]){platform[i].position.x, platform[i].position.y, platform[i].position.z});
+    instancing_set_color(&platformBatch, platform[i].id, platform[i].color);
   }
+
+  // Platforms are never hidden, so the whole batch can be recorded once
+  instancing_record(&platformBatch);
 }
 
-// Iterate through and run RSPQ blocks
+// Run the recorded batch
 void platform_drawBatch(void)
 {
-
-  // Draw material once per batch
-  rspq_block_run(materialBlock);
-
-  for (size_t i = 0; i < BLOCK_COUNT; i++)
-  {
-    if (rspqBlocks[i] != NULL) // Check for NULL before running
-    {
-      rspq_block_run(rspqBlocks[i]);
-    }
-  }
+  instancing_draw(&platformBatch, NULL);
 }
 
 // Generate a hexagonal grid of 19 platforms at desired height, with desired model and color
@@ -340,6 +382,7 @@ void platform_hexagonGrid(Platform *platform, T3DModel *model, float z, color_t
   }
 
   platform_assignGrid(platform);
+  platform_buildBuckets(platform);
 
   platform_createBatch(platform, model);
 }
@@ -347,19 +390,7 @@ void platform_hexagonGrid(Platform *platform, T3DModel *model, float z, color_t
 // Frees T3D model, matrices and RSPQ Blocks used for rendering
 void platform_destroy(Platform *platform)
 {
-  rspq_block_free(materialBlock);
-
-  for (size_t b = 0; b < BLOCK_COUNT; b++)
-  {
-    if (rspqBlocks[b] != NULL)
-      rspq_block_free(rspqBlocks[b]);
-  }
-
-  for (size_t p = 0; p < PLATFORM_COUNT; p++)
-  {
-    if (platform[p].mat != NULL)
-      free_uncached(platform[p].mat);
-  }
+  instancing_free(&platformBatch);
 
   if (batchModel != NULL)
     t3d_model_free(batchModel);
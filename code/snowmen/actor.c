@@ -446,24 +446,7 @@ bool CollideCapsuleMeshOctree(struct Actor* actor, const CapsuleCollider* capsul
 
 bool CollideCapsuleMeshCached(struct Actor* actor, const CapsuleCollider* capsule, T3DVec3* penetration_normal, float* penetration_depth)
 {
-  //debugf("Are we even getting here %d???????????????????????????????\n", actor->numCollisionTris);
-  //T3DVec3 verticies[3];
-  //int cringecounter = 0;
-    for (int i = 0; i < actor->numCollisionTris; i++)
-    {
-      //debugf("I guess we're here: %d???????????????????????????????\n", actor->numCollisionTris);
-        //verticies[0] = CollisionVertices[i]
-
-
-        if (CollideCapsuleTriangle(&actor->CollisionVertices[i*3], capsule, penetration_normal, penetration_depth))
-        {
-          //debugf("WOW! %d\n", cringecounter);
-            return true;
-        }
-        //cringecounter++;
-    }
-    //debugf("Aw... %d\n", cringecounter);
-    return false;
+    return CollideCapsuleCollisionMesh(&actor->collisionMesh, capsule, penetration_normal, penetration_depth);
 }
 
 bool TestCapsuleMeshCollision(Actor* CapsuleActor, Actor* StaticMeshActor, T3DVec3* penetration_normal, float* penetration_depth, float deltaTime)
@@ -629,69 +612,14 @@ void GenerateStaticCollisionNew(struct Actor* actor)
 {
   debugf("Matterial position: %f, %f, %f\n", actor->Transform.m[3][0], actor->Transform.m[3][1], actor->Transform.m[3][2]);
 
-    //const char *path = "rom:/mygame/box.col";
-    int size = 0;
-    CollisionStruct* model = asset_load(actor->collisionModelPath, &size);
-    if(memcmp(model, "COL", 3) != 0) 
-    {
-        assertf(false, "Invalid collision file: %s", actor->collisionModelPath);
-    }
-    assertf(model->magic[3] == 42,
-    "Invalid T3D model version: %d != %d\n"
-    "Please make a clean build of t3d and your project",
-    42, model->magic[3]);
-    /*debugf("Is indeed a collision file! Size: %d\n", size);
-    debugf("%d \n", model->totalTriCount);//uint16_t
-    debugf("%d \n", model->totalIndexCount);
-    for(int i = 0; i < model->totalTriCount; i ++)
-    {
-        debugf("    i = %d \n", i);
-        for(int j = 0; j < 3; j++)
-        {
-            debugf("%d \n", model->tris[i].verts[j].v[0]);
-            debugf("%d \n", model->tris[i].verts[j].v[1]);
-            debugf("%d \n", model->tris[i].verts[j].v[2]);
-        }
-    }*/
-
-    actor->CollisionVertices = malloc(sizeof(T3DVec3) * model->totalTriCount * 3);
-
-    T3DVec3 vertices[3];
-    for (int j = 0; j < model->totalTriCount; j ++) {
-        //GetVerticles(vertexFP, part, j);
-        int16_t vertexFP[3][3];
-        vertexFP[0][0] = model->tris[j].verts[0].v[0];
-        vertexFP[0][1] = model->tris[j].verts[0].v[1];
-        vertexFP[0][2] = model->tris[j].verts[0].v[2];
-        vertexFP[1][0] = model->tris[j].verts[1].v[0];
-        vertexFP[1][1] = model->tris[j].verts[1].v[1];
-        vertexFP[1][2] = model->tris[j].verts[1].v[2];
-        vertexFP[2][0] = model->tris[j].verts[2].v[0];
-        vertexFP[2][1] = model->tris[j].verts[2].v[1];
-        vertexFP[2][2] = model->tris[j].verts[2].v[2];
-
-        ConvertVerticies(vertices, vertexFP, &actor->Transform);
-
-        actor->CollisionVertices[j*3] = vertices[0];
-        actor->CollisionVertices[j*3 + 1] = vertices[1];
-        actor->CollisionVertices[j*3 + 2] = vertices[2];
-    }
-
-    actor->numCollisionTris = model->totalTriCount;
-    /*debugf("%f %f %f %f\n", actor->Transform.m[0][0], actor->Transform.m[0][1], actor->Transform.m[0][2], actor->Transform.m[0][3]);
-    debugf("%f %f %f %f\n", actor->Transform.m[1][0], actor->Transform.m[1][1], actor->Transform.m[1][2], actor->Transform.m[1][3]);
-    debugf("%f %f %f %f\n", actor->Transform.m[2][0], actor->Transform.m[2][1], actor->Transform.m[2][2], actor->Transform.m[2][3]);
-    debugf("%f %f %f %f\n", actor->Transform.m[3][0], actor->Transform.m[3][1], actor->Transform.m[3][2], actor->Transform.m[3][3]);*/
-
-
-  free(model);
+  LoadCollisionMesh(&actor->collisionMesh, actor->collisionModelPath, &actor->Transform);
 }
 
 void ActorFree(Actor* actor)
 {
   if(actor->collisionType == ECT_Mesh)
   {
-    free(actor->CollisionVertices);
+    FreeCollisionMesh(&actor->collisionMesh);
   }
 if(actor->dpl != NULL)
 {
@@ -11,22 +11,6 @@
 #include <t3d/t3danim.h>
 #include <t3d/t3ddebug.h>
 
-typedef struct {
-  int16_t v[3];
-} int16Vec;
-
-typedef struct {
-  int16Vec verts[3];
-} triangleCollision;
-
-typedef struct {
-  char magic[4];
-  uint16_t totalTriCount;
-  uint16_t totalIndexCount;
-
-  triangleCollision tris[];
-} CollisionStruct;
-
 enum ActorTypes {
     EAT_Player,
     EAT_Crate,
@@ -65,8 +49,7 @@ typedef struct Actor{
     T3DVec3 AABB_Max;
     T3DMat4 Transform;
     T3DMat4FP *TransformFP;
-    T3DVec3 *CollisionVertices;//large array of 3 verts (tris)
-    int numCollisionTris;
+    CollisionMesh collisionMesh;//loaded from collisionModelPath for ECT_Mesh
     Octree CollisionOctree;
     rspq_block_t *dpl;
     T3DVec3 BillboardPosition;
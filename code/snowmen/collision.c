@@ -35,20 +35,33 @@ bool CollideSphereSphere(const SphereCollider* s1, const SphereCollider* s2, T3D
 }//!!!Seems to be an issue where if radius is a certain radius (10, 30) it won't work???
 //returns weather it's a hit, penetration depth, and penetration normal
 
+static void TriangleNormal(T3DVec3* N, const T3DVec3* verticies)
+{
+    T3DVec3 v1v0;
+    t3d_vec3_diff(&v1v0, &verticies[1], &verticies[0]);
+    T3DVec3 v2v0;
+    t3d_vec3_diff(&v2v0, &verticies[2], &verticies[0]);
+    t3d_vec3_cross(N, &v1v0, &v2v0);
+    fast_vec3_norm(N);
+}
+
 bool CollideSphereTriangle(const T3DVec3* verticies, const SphereCollider* sphere, T3DVec3* penetration_normal, float* penetration_depth)//Requires tri struct, sphere center/radius
+{
+    T3DVec3 N;
+    TriangleNormal(&N, verticies);
+    return CollideSphereTriangleNormal(verticies, &N, sphere, penetration_normal, penetration_depth);
+}
+
+bool CollideSphereTriangleNormal(const T3DVec3* verticies, const T3DVec3* normal, const SphereCollider* sphere, T3DVec3* penetration_normal, float* penetration_depth)
 {
     //debugf("Cammy_0\n");
     //Get distance between the center of the sphere and the "plane" of the triangle by taking the dot product of the
-        // center - p0 and the normal vector of the triangle (gotten via cross product)
+        // center - p0 and the normal vector of the triangle (precomputed for collision meshes)
     //sphere_tri_counter++;
 
     T3DVec3 v1v0;
     t3d_vec3_diff(&v1v0, &verticies[1], &verticies[0]);
-    T3DVec3 v2v0;
-    t3d_vec3_diff(&v2v0, &verticies[2], &verticies[0]);
-    T3DVec3 N;
-    t3d_vec3_cross(&N, &v1v0, &v2v0);
-    fast_vec3_norm(&N);
+    const T3DVec3 N = *normal;
     //debugf("Cammy_1\n");
 
     T3DVec3 centerv0;
@@ -263,10 +276,16 @@ bool CollideCapsuleCapsule(const CapsuleCollider* c1, const CapsuleCollider* c2,
 //Returns
 
 bool CollideCapsuleTriangle(const T3DVec3* verticies, const CapsuleCollider* capsule, T3DVec3* penetration_normal, float* penetration_depth)//Will eventually go to sphere-triangle. Requires tri struct, and requires Tip and Base points, 
+{
+    T3DVec3 N;
+    TriangleNormal(&N, verticies);
+    return CollideCapsuleTriangleNormal(verticies, &N, capsule, penetration_normal, penetration_depth);
+}
+
+bool CollideCapsuleTriangleNormal(const T3DVec3* verticies, const T3DVec3* normal, const CapsuleCollider* capsule, T3DVec3* penetration_normal, float* penetration_depth)
 {
     if (!TestAABBCapsuleTriangle(capsule, verticies))
     {
-        //debugf("$$$$$$$$$$$$$$$$$CollideCapsuleTriangle : failed AABB test, don't try actual collision.\n");
         sphere_tri_counter++;
         return false;
     }
@@ -285,11 +304,7 @@ bool CollideCapsuleTriangle(const T3DVec3* verticies, const CapsuleCollider* cap
     //float t = dot(N, (p0 - base) / abs(dot(N, CapsuleNormal)));
     T3DVec3 v1v0;
     t3d_vec3_diff(&v1v0, &verticies[1], &verticies[0]);
-    T3DVec3 v2v0;
-    t3d_vec3_diff(&v2v0, &verticies[2], &verticies[0]);
-    T3DVec3 N;
-    t3d_vec3_cross(&N, &v1v0, &v2v0);
-    fast_vec3_norm(&N);
+    const T3DVec3 N = *normal;
 
     float dotncap = t3d_vec3_dot(&N, &CapsuleNormal);
     dotncap = fabs(dotncap);//!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
@@ -402,7 +417,7 @@ bool CollideCapsuleTriangle(const T3DVec3* verticies, const CapsuleCollider* cap
     T3DVec3 sphere_penetration_normal;
     float sphere_penetration_depth;
     //Finish with sphere-triangle intersection, do we need to do the whole thing? only last half?
-    bool iscollide = CollideSphereTriangle(verticies, &BestSphere, &sphere_penetration_normal, &sphere_penetration_depth);
+    bool iscollide = CollideSphereTriangleNormal(verticies, &N, &BestSphere, &sphere_penetration_normal, &sphere_penetration_depth);
 
     *penetration_normal = sphere_penetration_normal;
     *penetration_depth = sphere_penetration_depth;
@@ -530,6 +545,92 @@ bool CollideCapsuleMesh(const T3DModel* model, const T3DMat4* mat, const Capsule
 
 
 
+void LoadCollisionMesh(CollisionMesh* mesh, const char* path, const T3DMat4* mat)
+{
+    int size = 0;
+    CollisionFile* file = asset_load(path, &size);
+    assertf(memcmp(file->magic, "COL", 3) == 0, "Invalid collision file: %s", path);
+    assertf(file->version == COLLISION_FILE_VERSION,
+    "Invalid collision file version: %d != %d\n"
+    "Please rebuild %s with gltf_collision_importer",
+    file->version, COLLISION_FILE_VERSION, path);
+
+    const int16_t (*verticesFP)[3] = (const int16_t (*)[3])&file->chunks[file->chunkCount];
+    const uint16_t (*indices)[3] = (const uint16_t (*)[3])&verticesFP[file->vertexCount];
+    const int16_t (*normalsFP)[3] = (const int16_t (*)[3])&indices[file->triCount];
+
+    mesh->vertexCount = file->vertexCount;
+    mesh->triCount = file->triCount;
+    mesh->chunkCount = file->chunkCount;
+    mesh->vertices = malloc(sizeof(T3DVec3) * mesh->vertexCount);
+    mesh->indices = malloc(sizeof(uint16_t[3]) * mesh->triCount);
+    mesh->normals = malloc(sizeof(T3DVec3) * mesh->triCount);
+    mesh->chunks = malloc(sizeof(CollisionChunk) * mesh->chunkCount);
+
+    for (int i = 0; i < mesh->vertexCount; i++)
+    {
+        for (int k = 0; k < 3; k++)
+        {
+            mesh->vertices[i].v[k] = verticesFP[i][k] + mat->m[3][k];
+        }
+    }
+    memcpy(mesh->indices, indices, sizeof(uint16_t[3]) * mesh->triCount);
+    for (int i = 0; i < mesh->triCount; i++)
+    {
+        for (int k = 0; k < 3; k++)
+        {
+            mesh->normals[i].v[k] = normalsFP[i][k] * (1.0f / 32767.0f);
+        }
+    }
+    for (int c = 0; c < mesh->chunkCount; c++)
+    {
+        const CollisionFileChunk* chunk = &file->chunks[c];
+        for (int k = 0; k < 3; k++)
+        {
+            mesh->chunks[c].aabbMin.v[k] = chunk->aabbMin[k] + mat->m[3][k];
+            mesh->chunks[c].aabbMax.v[k] = chunk->aabbMax[k] + mat->m[3][k];
+        }
+        mesh->chunks[c].firstTri = chunk->firstTri;
+        mesh->chunks[c].triCount = chunk->triCount;
+    }
+
+    free(file);
+}
+
+void FreeCollisionMesh(CollisionMesh* mesh)
+{
+    free(mesh->vertices);
+    free(mesh->indices);
+    free(mesh->normals);
+    free(mesh->chunks);
+    *mesh = (CollisionMesh){0};
+}
+
+bool CollideCapsuleCollisionMesh(const CollisionMesh* mesh, const CapsuleCollider* capsule, T3DVec3* penetration_normal, float* penetration_depth)
+{
+    T3DVec3 verticies[3];
+    for (int c = 0; c < mesh->chunkCount; c++)
+    {
+        const CollisionChunk* chunk = &mesh->chunks[c];
+        if (!TestAABBvsAABB(&capsule->Capsule_AABB_Min, &capsule->Capsule_AABB_Max, &chunk->aabbMin, &chunk->aabbMax))
+        {
+            continue;
+        }
+        chunk_counter++;
+        for (int i = chunk->firstTri; i < chunk->firstTri + chunk->triCount; i++)
+        {
+            verticies[0] = mesh->vertices[mesh->indices[i][0]];
+            verticies[1] = mesh->vertices[mesh->indices[i][1]];
+            verticies[2] = mesh->vertices[mesh->indices[i][2]];
+            if (CollideCapsuleTriangleNormal(verticies, &mesh->normals[i], capsule, penetration_normal, penetration_depth))
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
 void ClosestPointOnLineSegment(T3DVec3* res, const T3DVec3* A, const T3DVec3* B, const T3DVec3* Point)//requires two distances (_____) and point
 {
     T3DVec3 AB;
@@ -35,6 +35,47 @@ typedef struct {
     T3DVec3 Capsule_AABB_Max;
 } CapsuleCollider;
 
+//.col file written by my_tools/gltf_collision_importer, all values are big-endian
+#define COLLISION_FILE_VERSION 2
+
+typedef struct {
+    int16_t aabbMin[3];
+    int16_t aabbMax[3];
+    uint16_t firstTri;
+    uint16_t triCount;
+} CollisionFileChunk;
+
+typedef struct {
+    char magic[3];//"COL"
+    uint8_t version;
+    uint16_t vertexCount;
+    uint16_t triCount;
+    uint16_t chunkCount;
+    uint16_t reserved;
+    CollisionFileChunk chunks[];
+    //followed by int16_t vertices[vertexCount][3], 16.0 fixed point
+    //            uint16_t indices[triCount][3]
+    //            int16_t normals[triCount][3], 1.15 fixed point
+} CollisionFile;
+
+typedef struct {
+    T3DVec3 aabbMin;
+    T3DVec3 aabbMax;
+    uint16_t firstTri;
+    uint16_t triCount;
+} CollisionChunk;
+
+//Indexed collision mesh, vertices and chunk bounds already moved to where the mesh was placed
+typedef struct {
+    int vertexCount;
+    int triCount;
+    int chunkCount;
+    T3DVec3* vertices;
+    uint16_t (*indices)[3];
+    T3DVec3* normals;//one per triangle
+    CollisionChunk* chunks;
+} CollisionMesh;
+
 
 
 
@@ -53,6 +94,8 @@ bool CollideSphereSphere(const SphereCollider*, const SphereCollider*, T3DVec3*,
 bool CollideSphereTriangle(const T3DVec3*, const SphereCollider*, T3DVec3*, float*);//Requires tri struct, sphere center/radius
 //const T3DObject* mesh replace verticies
 
+bool CollideSphereTriangleNormal(const T3DVec3*, const T3DVec3*, const SphereCollider*, T3DVec3*, float*);//Same, with the unit normal of the tri already known
+
 void CollideCapsuleSphere();//Very similar to sphere-sphere collision, just find closes point on line to sphere for the capsule
 
 bool CollideCapsuleCapsule(const CapsuleCollider*, const CapsuleCollider*, T3DVec3*, float*);//will eventually go to sphere-sphere. Requires Tip and Base points, as well as sphere stuff, for both
@@ -62,8 +105,16 @@ bool CollideCapsuleTriangle(const T3DVec3*, const CapsuleCollider*, T3DVec3*, fl
     //as well as sphere stuff, for the capsule
 //const T3DObject* mesh replace verticies
 
+bool CollideCapsuleTriangleNormal(const T3DVec3*, const T3DVec3*, const CapsuleCollider*, T3DVec3*, float*);//Same, with the unit normal of the tri already known
+
 bool CollideCapsuleMesh(const T3DModel*, const T3DMat4*, const CapsuleCollider*, T3DVec3*, float*);//Will eventually go to sphere-triangle. Requires tri struct, and requires Tip and Base points, 
 
+void LoadCollisionMesh(CollisionMesh* mesh, const char* path, const T3DMat4* mat);//loads a .col file, only the translation of mat is applied (same as ConvertVerticies)
+
+void FreeCollisionMesh(CollisionMesh* mesh);
+
+bool CollideCapsuleCollisionMesh(const CollisionMesh* mesh, const CapsuleCollider* capsule, T3DVec3* penetration_normal, float* penetration_depth);//skips chunks whose AABB misses the capsule AABB
+
 
 void GetVerticles(int16_t vertex[3][3], const T3DObjectPart *part, int j);
 //returns struct of 3 vectors for each point of the tri
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ * Content-addressed store for converted assets.
+ * Outputs are keyed by a hash of the source file, the output type and the converter version,
+ * so an unchanged source is never converted twice, no matter its name or timestamp.
+ */
+class AssetCache
+{
+  private:
+    std::filesystem::path dir{};
+
+    static uint64_t hashData(const uint8_t* data, size_t size, uint64_t hash) {
+      // FNV-1a
+      for(size_t i=0; i<size; ++i) {
+        hash ^= data[i];
+        hash *= 0x100000001B3ull;
+      }
+      return hash;
+    }
+
+    std::filesystem::path getPath(uint64_t sourceHash, const std::string &ext) const {
+      auto key = ext + "@" + std::to_string(VERSION);
+      uint64_t hash = hashData((const uint8_t*)key.data(), key.size(), sourceHash);
+      char name[17];
+      snprintf(name, sizeof(name), "%016llx", (unsigned long long)hash);
+      return dir / (std::string{name} + ext);
+    }
+
+  public:
+    // Bump this whenever a converter changes its output
+    static constexpr uint32_t VERSION = 2;
+
+    explicit AssetCache(const std::filesystem::path &cacheDir) : dir{cacheDir} {
+      if(!dir.empty())std::filesystem::create_directories(dir);
+    }
+
+    [[nodiscard]] bool isEnabled() const {
+      return !dir.empty();
+    }
+
+    static uint64_t hashFile(const std::filesystem::path &path) {
+      std::ifstream file{path, std::ios::binary};
+      std::vector<uint8_t> data{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+      return hashData(data.data(), data.size(), 0xCBF29CE484222325ull);
+    }
+
+    /**
+     * Copies a previously converted output to 'outPath', returns false if there is none.
+     */
+    bool fetch(uint64_t sourceHash, const std::string &ext, const std::filesystem::path &outPath) const {
+      if(!isEnabled())return false;
+      std::error_code err{};
+      std::filesystem::copy_file(getPath(sourceHash, ext), outPath,
+        std::filesystem::copy_options::overwrite_existing, err);
+      return !err;
+    }
+
+    void store(uint64_t sourceHash, const std::string &ext, const uint8_t* data, size_t size) const {
+      if(!isEnabled())return;
+      // Written under a unique name first, parallel builds may store the same entry at once
+      auto path = getPath(sourceHash, ext);
+      auto tmpPath = path;
+      tmpPath += "." + std::to_string(std::random_device{}()) + ".tmp";
+      FILE* file = fopen(tmpPath.c_str(), "wb");
+      if(!file)return;
+      fwrite(data, 1, size, file);
+      fclose(file);
+      std::error_code err{};
+      std::filesystem::rename(tmpPath, path, err);
+      if(err)std::filesystem::remove(tmpPath, err);
+    }
+};
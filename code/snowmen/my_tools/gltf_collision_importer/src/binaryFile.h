@@ -108,6 +108,10 @@ class BinaryFile
       return dataSize;
     }
 
+    const uint8_t* getData() const {
+      return data.data();
+    }
+
     void writeToFile(const char* filename) {
       FILE* file = fopen(filename, "wb");
       fwrite(data.data(), 1, dataSize, file);
@@ -0,0 +1,149 @@
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <unordered_map>
+#include "converter.h"
+
+namespace {
+  constexpr uint8_t COLLISION_VERSION = 2;
+  // Triangles per chunk, the runtime tests the chunk AABB before any of its triangles
+  constexpr uint32_t CHUNK_MAX_TRIS = 32;
+
+  struct CollTri {
+    uint16_t index[3]{};
+    int16_t normal[3]{};
+    float center[3]{};
+  };
+
+  struct CollChunk {
+    int16_t aabbMin[3]{};
+    int16_t aabbMax[3]{};
+    uint32_t firstTri{};
+    uint32_t triCount{};
+  };
+
+  uint16_t getVertexIndex(std::unordered_map<uint64_t, uint16_t> &indexMap, std::vector<int16_t> &vertices, const int16_t pos[3])
+  {
+    uint64_t key = ((uint64_t)(uint16_t)pos[0] << 32) | ((uint64_t)(uint16_t)pos[1] << 16) | (uint16_t)pos[2];
+    auto it = indexMap.find(key);
+    if(it != indexMap.end())return it->second;
+
+    if(vertices.size() / 3 >= 0xFFFF) {
+      throw std::runtime_error("Collision mesh has too many vertices (max. 65535)");
+    }
+    auto index = (uint16_t)(vertices.size() / 3);
+    vertices.insert(vertices.end(), pos, pos + 3);
+    indexMap[key] = index;
+    return index;
+  }
+
+  // Same face normal the runtime would get from cross(v1 - v0, v2 - v0), quantized to 1.15 fixed point
+  void calcNormal(CollTri &tri, const std::vector<int16_t> &vertices)
+  {
+    double v[3][3];
+    for(int i=0; i<3; ++i) {
+      for(int j=0; j<3; ++j)v[i][j] = vertices[tri.index[i]*3 + j];
+    }
+    double e1[3] = {v[1][0] - v[0][0], v[1][1] - v[0][1], v[1][2] - v[0][2]};
+    double e2[3] = {v[2][0] - v[0][0], v[2][1] - v[0][1], v[2][2] - v[0][2]};
+    double n[3] = {
+      e1[1] * e2[2] - e1[2] * e2[1],
+      e1[2] * e2[0] - e1[0] * e2[2],
+      e1[0] * e2[1] - e1[1] * e2[0]
+    };
+    double len = sqrt(n[0]*n[0] + n[1]*n[1] + n[2]*n[2]);
+    for(int j=0; j<3; ++j) {
+      tri.normal[j] = len > 0.0 ? (int16_t)lround(n[j] / len * 32767.0) : 0;
+      tri.center[j] = (float)((v[0][j] + v[1][j] + v[2][j]) / 3.0);
+    }
+  }
+
+  /**
+   * Splits the triangles at the median of the longest axis until each chunk is small enough.
+   * Triangles of a chunk end up next to each other in 'tris'.
+   */
+  void splitChunks(std::vector<CollTri> &tris, uint32_t first, uint32_t count,
+    const std::vector<int16_t> &vertices, std::vector<CollChunk> &chunks)
+  {
+    CollChunk chunk{.firstTri = first, .triCount = count};
+    for(int j=0; j<3; ++j) {
+      chunk.aabbMin[j] = INT16_MAX;
+      chunk.aabbMax[j] = INT16_MIN;
+    }
+    for(uint32_t t=first; t<first+count; ++t) {
+      for(auto idx : tris[t].index) {
+        for(int j=0; j<3; ++j) {
+          chunk.aabbMin[j] = std::min(chunk.aabbMin[j], vertices[idx*3 + j]);
+          chunk.aabbMax[j] = std::max(chunk.aabbMax[j], vertices[idx*3 + j]);
+        }
+      }
+    }
+
+    if(count <= CHUNK_MAX_TRIS) {
+      chunks.push_back(chunk);
+      return;
+    }
+
+    int axis = 0;
+    for(int j=1; j<3; ++j) {
+      if(chunk.aabbMax[j] - chunk.aabbMin[j] > chunk.aabbMax[axis] - chunk.aabbMin[axis])axis = j;
+    }
+    uint32_t half = count / 2;
+    std::nth_element(tris.begin() + first, tris.begin() + first + half, tris.begin() + first + count,
+      [axis](const CollTri &a, const CollTri &b) { return a.center[axis] < b.center[axis]; });
+
+    splitChunks(tris, first, half, vertices, chunks);
+    splitChunks(tris, first + half, count - half, vertices, chunks);
+  }
+}
+
+BinaryFile convertCollision(const std::vector<ModelCustom> &models)
+{
+  std::unordered_map<uint64_t, uint16_t> indexMap{};
+  std::vector<int16_t> vertices{};
+  std::vector<CollTri> tris{};
+  std::vector<CollChunk> chunks{};
+
+  for(auto &model : models)
+  {
+    uint32_t first = tris.size();
+    for(auto &triangle : model.triangles) {
+      CollTri tri{};
+      for(int i=0; i<3; ++i) {
+        tri.index[i] = getVertexIndex(indexMap, vertices, triangle.vert[i].pos);
+      }
+      calcNormal(tri, vertices);
+      tris.push_back(tri);
+    }
+    if(tris.size() > first) {
+      splitChunks(tris, first, tris.size() - first, vertices, chunks);
+    }
+  }
+
+  if(tris.size() > 0xFFFF || chunks.size() > 0xFFFF) {
+    throw std::runtime_error("Collision mesh has too many triangles (max. 65535)");
+  }
+
+  BinaryFile file{};
+  file.writeChars("COL", 3);
+  file.write<uint8_t>(COLLISION_VERSION);
+  file.write<uint16_t>(vertices.size() / 3);
+  file.write<uint16_t>(tris.size());
+  file.write<uint16_t>(chunks.size());
+  file.write<uint16_t>(0); // reserved
+
+  for(auto &chunk : chunks) {
+    file.writeArray(chunk.aabbMin, 3);
+    file.writeArray(chunk.aabbMax, 3);
+    file.write<uint16_t>(chunk.firstTri);
+    file.write<uint16_t>(chunk.triCount);
+  }
+
+  file.writeArray(vertices.data(), vertices.size());
+  for(auto &tri : tris)file.writeArray(tri.index, 3);
+  for(auto &tri : tris)file.writeArray(tri.normal, 3);
+  file.align(4);
+
+  printf("Collision: %d tris, %d verts, %d chunks\n", (int)tris.size(), (int)(vertices.size() / 3), (int)chunks.size());
+  return file;
+}
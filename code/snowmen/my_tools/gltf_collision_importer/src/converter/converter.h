@@ -7,6 +7,7 @@
 
 #include "../math/mat4.h"
 #include "../structs.h"
+#include "../binaryFile.h"
 
 void convertVertex(
   float modelScale, float texSizeX, float texSizeY, const VertexNorm &v, VertexT3D &vT3D,
@@ -14,4 +15,10 @@ void convertVertex(
 );
 ModelChunked chunkUpModel(const Model& model);
 
-void convertAnimation(Anim &anim, const std::unordered_map<std::string, const Bone*> &nodeMap);
\ No newline at end of file
+void convertAnimation(Anim &anim, const std::unordered_map<std::string, const Bone*> &nodeMap);
+
+/**
+ * Indexed collision mesh (.col): deduplicated 16.0 vertices, 16-bit indices,
+ * quantized face normals and triangle chunks with their AABB.
+ */
+BinaryFile convertCollision(const std::vector<ModelCustom> &models);
\ No newline at end of file
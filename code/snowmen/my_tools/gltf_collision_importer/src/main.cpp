@@ -7,6 +7,7 @@
 #include <filesystem>
 #include <algorithm>
 #include <cassert>
+#include <chrono>
 
 #include "structs.h"
 #include "parser.h"
@@ -14,6 +15,7 @@
 #include "args.h"
 
 #include "binaryFile.h"
+#include "assetCache.h"
 #include "converter/converter.h"
 #include "parser/rdp.h"
 #include "optimizer/optimizer.h"
@@ -70,7 +72,7 @@ int main(int argc, char* argv[])
 {
     EnvArgs args{argc, argv};
   if(args.checkArg("--help")) {
-    printf("Usage: %s <gltf-file> <t3dm-file> [--bvh] [--base-scale=64] [--ignore-materials] [--verbose]\n", argv[0]);
+    printf("Usage: %s <gltf-file> <t3dm-file> [--bvh] [--base-scale=64] [--ignore-materials] [--verbose] [--cache=<dir>]\n", argv[0]);
     return 1;
   }
   
@@ -83,34 +85,25 @@ int main(int argc, char* argv[])
 
   printf("gltfPath: %s & t3dmPath%s\n", gltfPath.c_str(), t3dmPath.c_str());
 
-  auto allModels = parseGLTFCustom(gltfPath.c_str(), config.globalScale);
-  fs::path gltfBasePath{gltfPath};
-  
-  uint16_t totalTriCount = 0;
-
-  BinaryFile file{};
-  file.writeChars("COL", 3);
-  //file.write(chunkCount);
-  file.write<uint8_t>(42);
-  file.write<uint16_t>(69); // total vertex count (set later)
-  file.write<uint16_t>(420); // total index count (set later)
-  /*file.write(allModels[0].triangles[0].vert[0].pos[0]);
-  file.write(allModels[0].triangles[0].vert[0].pos[1]);
-  file.write(allModels[0].triangles[0].vert[0].pos[2]);*/
-  for (int i = 0; i < allModels[0].triangles.size(); i++)
-  {
-    for (int j = 0; j < 3; j++)
-    {
-      file.write(allModels[0].triangles[i].vert[j].pos[0]);
-      file.write(allModels[0].triangles[i].vert[j].pos[1]);
-      file.write(allModels[0].triangles[i].vert[j].pos[2]);
-      
-    }
-    totalTriCount++;
+  // Unchanged sources are copied from the cache instead of being converted again,
+  // only .glb files are cached since external buffers of a .gltf are not part of the hash
+  auto timeStart = std::chrono::steady_clock::now();
+  auto printTime = [&](const char* suffix) {
+    auto time = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - timeStart);
+    printf("    [COL] %s: %.1fms%s\n", gltfPath.c_str(), time.count(), suffix);
+  };
+
+  AssetCache cache{fs::path{gltfPath}.extension() == ".glb" ? args.getStringArg("--cache") : ""};
+  uint64_t gltfHash = cache.isEnabled() ? AssetCache::hashFile(gltfPath) : 0;
+  if(cache.fetch(gltfHash, ".col", t3dmPath)) {
+    printTime(" (cached)");
+    return 0;
   }
 
-  file.setPos(0x04);
-  file.write(totalTriCount);
+  auto allModels = parseGLTFCustom(gltfPath.c_str(), config.globalScale);
+  BinaryFile file = convertCollision(allModels);
 
   file.writeToFile(t3dmPath.c_str());
+  cache.store(gltfHash, ".col", file.getData(), file.getSize());
+  printTime("");
 }
\ No newline at end of file
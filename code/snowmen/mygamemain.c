@@ -1,5 +1,6 @@
 #include <libdragon.h>
 #include "../../core.h"
+#include "../../assetcache.h"
 #include "../../minigame.h"
 
  #include "collision.h"
@@ -67,10 +68,10 @@ rspq_block_t *dplTree;
 T3DModel *treeModel;
 
 
-wav64_t sfx_start;
-wav64_t sfx_countdown;
-wav64_t sfx_stop;
-wav64_t sfx_winner;
+wav64_t* sfx_start;
+wav64_t* sfx_countdown;
+wav64_t* sfx_stop;
+wav64_t* sfx_winner;
 xm64player_t music;
 
 bool fullScreen;
@@ -885,7 +886,7 @@ void AIPlayerLoop(PlayerStruct* playerStruct, int seed, float deltaTime)
                             if (GameEnd)
                             {
                                 xm64player_stop(&music);
-                                wav64_play(&sfx_stop, 31);
+                                wav64_play(sfx_stop, 31);
                             }
                             playerStruct->AIState = EPAIS_Idle;
                             debugf("return to idle from Force add snowman\n");
@@ -1130,7 +1131,7 @@ void minigame_init()
         color_from_packed32(0x00FF00<<8),
     };
 
-    fontBillboard = rdpq_font_load("rom:/squarewave.font64");
+    fontBillboard = assetcache_get_font(ASSETCACHE_FONT_SQUAREWAVE);
     rdpq_text_register_font(FONT_BILLBOARD, fontBillboard);
     for (size_t i = 0; i < MAXPLAYERS; i++)
     {
@@ -1409,10 +1410,10 @@ T3DModel *treeModel;*/
 
     syncPoint = 0;
     mixer_ch_set_limits(30, 0, 44100.0, 0);
-    wav64_open(&sfx_start, "rom:/core/Start.wav64");
-    wav64_open(&sfx_countdown, "rom:/core/Countdown.wav64");
-    wav64_open(&sfx_stop, "rom:/core/Stop.wav64");
-    wav64_open(&sfx_winner, "rom:/core/Winner.wav64");
+    sfx_start = assetcache_get_sound(ASSETCACHE_SFX_START);
+    sfx_countdown = assetcache_get_sound(ASSETCACHE_SFX_COUNTDOWN);
+    sfx_stop = assetcache_get_sound(ASSETCACHE_SFX_STOP);
+    sfx_winner = assetcache_get_sound(ASSETCACHE_SFX_WINNER);
     //xm64player_open(&music, "rom:/snake3d/bottled_bubbles.xm64");
      xm64player_open(&music, "rom:/snowmen/christmas_day.xm64");
     //xm64player_play(&music, 0);
@@ -1803,7 +1804,7 @@ void GameOver(float deltatime)
                     }
                     i++;
                 }
-                wav64_play(&sfx_winner, 31);
+                wav64_play(sfx_winner, 31);
             }
             WinnerDelay -= deltatime;
         }
@@ -1848,7 +1849,7 @@ void minigame_fixedloop(float deltatime)
     if (GameEnd == true) 
     {
                     //xm64player_stop(&music);
-                    //wav64_play(&sfx_stop, 31);
+                    //wav64_play(sfx_stop, 31);
         if (EndDelay <= 0.f)
         {
             GameOver(deltatime);
@@ -1897,7 +1898,7 @@ void minigame_fixedloop(float deltatime)
         if (StartTimer <= 0.f)
         {
             debugf("Start!\n");
-            wav64_play(&sfx_start, 31);
+            wav64_play(sfx_start, 31);
             xm64player_play(&music, 0);
             PlayerControl = true;
         }
@@ -1905,7 +1906,7 @@ void minigame_fixedloop(float deltatime)
         {
             if ((int) prevStartTime != (int) (StartTimer))
             {
-                wav64_play(&sfx_countdown, 31);
+                wav64_play(sfx_countdown, 31);
                 
                 SpawnSnowball();
             }
@@ -1920,7 +1921,7 @@ void minigame_fixedloop(float deltatime)
         {
             GameTimer = 0.f;
             debugf("TIME!\n");
-            wav64_play(&sfx_stop, 31);
+            wav64_play(sfx_stop, 31);
             xm64player_stop(&music);
             GameEnd = true;
 
@@ -2215,7 +2216,7 @@ void minigame_fixedloop(float deltatime)
                 if (GameEnd)
                 {
                     xm64player_stop(&music);
-                    wav64_play(&sfx_stop, 31);
+                    wav64_play(sfx_stop, 31);
                 }
             }
         }
@@ -2248,7 +2249,7 @@ void minigame_fixedloop(float deltatime)
                     if (GameEnd)
                     {
                         xm64player_stop(&music);
-                        wav64_play(&sfx_stop, 31);
+                        wav64_play(sfx_stop, 31);
                     }
                 }
             } 
@@ -2398,10 +2399,10 @@ void minigame_cleanup()
         PlayerCleanup(&players[0]);
     }*/
 //MUST STOP MY MUSIC IT WILL INVADE THE OTHER GAMES MY GOD
-    wav64_close(&sfx_start);
-    wav64_close(&sfx_countdown);
-    wav64_close(&sfx_stop);
-    wav64_close(&sfx_winner);
+    assetcache_release_sound(sfx_start);
+    assetcache_release_sound(sfx_countdown);
+    assetcache_release_sound(sfx_stop);
+    assetcache_release_sound(sfx_winner);
     xm64player_stop(&music);
     xm64player_close(&music);
 
@@ -2439,7 +2440,7 @@ void minigame_cleanup()
     rdpq_text_unregister_font(FONT_TEXT);
     rdpq_text_unregister_font(FONT_BILLBOARD);
     rdpq_font_free(font);
-    rdpq_font_free(fontBillboard);
+    assetcache_release_font(fontBillboard);
 
 
     t3d_destroy(); 
@@ -6,6 +6,7 @@
 #include <t3d/t3dmath.h>
 #include <t3d/t3dmodel.h>
 #include "../../core.h"
+#include "../../assetcache.h"
 #include "../../minigame.h"
 #include "world.h"
 #include "gfx.h"
@@ -16,10 +17,10 @@ color_t uicolor;
 rdpq_font_t *font;
 rdpq_font_t *font2;
 
-wav64_t sfx_start;
-wav64_t sfx_countdown;
-wav64_t sfx_stop;
-wav64_t sfx_winner;
+wav64_t* sfx_start;
+wav64_t* sfx_countdown;
+wav64_t* sfx_stop;
+wav64_t* sfx_winner;
 
 sprite_t *sprites[SPRITE_COUNT];
 
@@ -125,10 +126,10 @@ void gfx_load(){
     rdpq_font_style(font, STYLE_DEFAULT, &(rdpq_fontstyle_t){.color = uicolor});
     rdpq_font_style(font2, STYLE_DEFAULT, &(rdpq_fontstyle_t){.color = uicolor});
 
-    wav64_open(&sfx_start, "rom:/core/Start.wav64");
-    wav64_open(&sfx_countdown, "rom:/core/Countdown.wav64");
-    wav64_open(&sfx_stop, "rom:/core/Stop.wav64");
-    wav64_open(&sfx_winner, "rom:/core/Winner.wav64");
+    sfx_start = assetcache_get_sound(ASSETCACHE_SFX_START);
+    sfx_countdown = assetcache_get_sound(ASSETCACHE_SFX_COUNTDOWN);
+    sfx_stop = assetcache_get_sound(ASSETCACHE_SFX_STOP);
+    sfx_winner = assetcache_get_sound(ASSETCACHE_SFX_WINNER);
 
     for (uint32_t i = 0; i < SPRITE_COUNT; i++)
         sprites[i] = sprite_load(texture_path[i]);
@@ -185,10 +186,10 @@ void gfx_close(){
     if(font) rdpq_font_free(font);
     if(font2) rdpq_font_free(font2);
 
-    wav64_close(&sfx_start);
-    wav64_close(&sfx_countdown);
-    wav64_close(&sfx_stop);
-    wav64_close(&sfx_winner);
+    assetcache_release_sound(sfx_start);
+    assetcache_release_sound(sfx_countdown);
+    assetcache_release_sound(sfx_stop);
+    assetcache_release_sound(sfx_winner);
 
     for (uint32_t i = 0; i < SPRITE_COUNT; i++)
         sprite_free(sprites[i]);
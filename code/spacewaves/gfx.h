@@ -31,10 +31,10 @@
 
 extern rdpq_font_t *font;
 
-extern wav64_t sfx_start;
-extern wav64_t sfx_countdown;
-extern wav64_t sfx_stop;
-extern wav64_t sfx_winner;
+extern wav64_t* sfx_start;
+extern wav64_t* sfx_countdown;
+extern wav64_t* sfx_stop;
+extern wav64_t* sfx_winner;
 
 extern sprite_t *sprites[SPRITE_COUNT];
 extern const char *texture_path[SPRITE_COUNT];
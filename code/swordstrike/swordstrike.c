@@ -8,6 +8,7 @@
 #include "functions.h"
 #include "levels.h"
 #include "../../core.h"
+#include "../../assetcache.h"
 #include "../../minigame.h"
 #include <t3d/t3d.h>
 #include <t3d/t3dmath.h>
@@ -54,7 +55,8 @@ struct player* players[4];
 int numFloors;
 struct floorPiece **floors;
 
-wav64_t sfx_start, sfx_countdown, sfx_stop, sfx_winner, sfx_scream;
+wav64_t *sfx_start, *sfx_countdown, *sfx_stop, *sfx_winner;
+wav64_t sfx_scream;
 wav64_t music;
 
 // number of players specified before loading game
@@ -133,7 +135,7 @@ T3DVec3 lightDirVec;
 
 void minigame_init(){
     // load font for text drawing
-    font = rdpq_font_load("rom:/squarewave.font64");
+    font = assetcache_get_font(ASSETCACHE_FONT_SQUAREWAVE);
     rdpq_text_register_font(FONT_TEXT, font);
     rdpq_font_style(font, 0, &(rdpq_fontstyle_t){.color = color_from_packed32(TEXT_COLOR) });
 
@@ -358,10 +360,10 @@ void minigame_init(){
     playDeathSound = false;
 
     // load sound files
-    wav64_open(&sfx_start, "rom:/core/Start.wav64");
-    wav64_open(&sfx_countdown, "rom:/core/Countdown.wav64");
-    wav64_open(&sfx_stop, "rom:/core/Stop.wav64");
-    wav64_open(&sfx_winner, "rom:/core/Winner.wav64");
+    sfx_start = assetcache_get_sound(ASSETCACHE_SFX_START);
+    sfx_countdown = assetcache_get_sound(ASSETCACHE_SFX_COUNTDOWN);
+    sfx_stop = assetcache_get_sound(ASSETCACHE_SFX_STOP);
+    sfx_winner = assetcache_get_sound(ASSETCACHE_SFX_WINNER);
     wav64_open(&sfx_scream, "rom:/swordstrike/wilhelm_scream.wav64");
     wav64_open(&music, "rom:/swordstrike/challengers.wav64");
     wav64_set_loop(&music, true);
@@ -426,11 +428,11 @@ void minigame_fixedloop(float deltatime){
             float prevtime = countdown_timer;
             countdown_timer -= deltatime;
             if ((int)prevtime != (int)countdown_timer && countdown_timer >= 0) {
-                wav64_play(&sfx_countdown, CHANNEL_SFX);
+                wav64_play(sfx_countdown, CHANNEL_SFX);
             }
         } else {
             game_state = 1;
-            wav64_play(&sfx_start, CHANNEL_SFX);
+            wav64_play(sfx_start, CHANNEL_SFX);
             wav64_play(&music, CHANNEL_MUSIC);
         }
     }
@@ -450,7 +452,7 @@ void minigame_fixedloop(float deltatime){
                 }
             }
             mixer_ch_set_vol(CHANNEL_MUSIC, 0, 0);
-            wav64_play(&sfx_stop, CHANNEL_SFX);
+            wav64_play(sfx_stop, CHANNEL_SFX);
             game_state = 2;
         }
         // shouldn't be possible but adding this just in case
@@ -523,7 +525,7 @@ void minigame_fixedloop(float deltatime){
     if(game_state == 2){
         if(game_over_counter < 5.0 && !playedWinnerSound){
             playedWinnerSound = true;
-            wav64_play(&sfx_winner, CHANNEL_SFX);
+            wav64_play(sfx_winner, CHANNEL_SFX);
         }
         game_over_counter -= deltatime;
         if(game_over_counter <= 0){
@@ -711,10 +713,10 @@ void free_level_data(struct floorPiece **floors){
 
 void minigame_cleanup(){
     // close audio file streams
-    wav64_close(&sfx_start);
-    wav64_close(&sfx_countdown);
-    wav64_close(&sfx_stop);
-    wav64_close(&sfx_winner);
+    assetcache_release_sound(sfx_start);
+    assetcache_release_sound(sfx_countdown);
+    assetcache_release_sound(sfx_stop);
+    assetcache_release_sound(sfx_winner);
     wav64_close(&sfx_scream);
     wav64_close(&music);
 
@@ -750,7 +752,7 @@ void minigame_cleanup(){
     sprite_free(fighter_right_attack_10);
 
     // free fonts
-    rdpq_font_free(font);
+    assetcache_release_font(font);
     rdpq_text_unregister_font(FONT_TEXT);
 
     // t3d cleanup
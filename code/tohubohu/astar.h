@@ -3,12 +3,14 @@
 #ifndef __ASTAR_H
 #define __ASTAR_H
 
+#include <assert.h>
 #include <math.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
+#include "grid.h"
 
 typedef struct {
     int x;
@@ -56,6 +58,17 @@ typedef struct {
     cell_t cells[];
 } path_t;
 
+typedef enum {
+    PATH_SEARCH_ASTAR = 0,  // Expands every neighbour given by add_neighbours
+    PATH_SEARCH_JPS,        // Jump Point Search, 8-way uniform-cost grids only
+} path_search_t;
+
+typedef struct {
+    size_t expanded;    // Nodes taken out of the open list
+    size_t generated;   // Node records created
+    size_t scanned;     // Grid cells looked at while jumping (JPS only)
+} path_stats_t;
+
 const node_t empty_node = {NULL, -1};
 
 
@@ -259,7 +272,153 @@ void add_neighbour(node_list_t* list, cell_t cell, float edgeCost) {
     list->count++;
 }
 
-path_t* find_path(cell_t start, cell_t target, int max_cost, int max_visit) {
+// Neighbours generator for occupancy grids, can be used to implement add_neighbours
+void add_grid_neighbours(node_list_t* list, const grid_t* grid, cell_t cell, bool diagonals) {
+    for (int y=cell.y-1; y<=cell.y+1; y++) {
+        for (int x=cell.x-1; x<=cell.x+1; x++) {
+            if (x == cell.x && y == cell.y) {
+                continue;
+            }
+            const bool straight = (x == cell.x || y == cell.y);
+            if ((straight || diagonals) && !grid_is_blocked(grid, x, y)) {
+                add_neighbour(list, (cell_t){x, y}, straight ? 1 : 1.414);
+            }
+        }
+    }
+}
+
+
+// Jump Point Search (Harabor & Grastien), variant where diagonal moves are always
+// allowed as in add_grid_neighbours: only the jump points are added to the open
+// list, and straight runs in between are skipped without creating node records.
+
+int sign(int v) {
+    return (v > 0) - (v < 0);
+}
+
+float octile_cost(cell_t from, cell_t to) {
+    const int dx = abs(to.x - from.x);
+    const int dy = abs(to.y - from.y);
+    return (dx < dy) ? (dx * 1.414f + (dy - dx)) : (dy * 1.414f + (dx - dy));
+}
+
+bool is_open_cell(const grid_t* grid, int x, int y) {
+    return !grid_is_blocked(grid, x, y);
+}
+
+bool jump_straight(const grid_t* grid, cell_t cell, int dx, int dy, cell_t target, cell_t* jump_point, path_stats_t* stats) {
+    int x = cell.x;
+    int y = cell.y;
+    while (is_open_cell(grid, x, y)) {
+        stats->scanned++;
+        if (x == target.x && y == target.y) {
+            *jump_point = (cell_t){x, y};
+            return true;
+        }
+        if (dx != 0) {
+            if ((is_open_cell(grid, x+dx, y+1) && !is_open_cell(grid, x, y+1)) ||
+                (is_open_cell(grid, x+dx, y-1) && !is_open_cell(grid, x, y-1))) {
+                *jump_point = (cell_t){x, y};
+                return true;
+            }
+        } else {
+            if ((is_open_cell(grid, x+1, y+dy) && !is_open_cell(grid, x+1, y)) ||
+                (is_open_cell(grid, x-1, y+dy) && !is_open_cell(grid, x-1, y))) {
+                *jump_point = (cell_t){x, y};
+                return true;
+            }
+        }
+        x += dx;
+        y += dy;
+    }
+    return false;
+}
+
+bool jump(const grid_t* grid, cell_t cell, int dx, int dy, cell_t target, cell_t* jump_point, path_stats_t* stats) {
+    if (dx == 0 || dy == 0) {
+        return jump_straight(grid, cell, dx, dy, target, jump_point, stats);
+    }
+    int x = cell.x;
+    int y = cell.y;
+    cell_t unused;
+    while (is_open_cell(grid, x, y)) {
+        stats->scanned++;
+        if ((x == target.x && y == target.y) ||
+            (is_open_cell(grid, x-dx, y+dy) && !is_open_cell(grid, x-dx, y)) ||
+            (is_open_cell(grid, x+dx, y-dy) && !is_open_cell(grid, x, y-dy)) ||
+            jump_straight(grid, (cell_t){x+dx, y}, dx, 0, target, &unused, stats) ||
+            jump_straight(grid, (cell_t){x, y+dy}, 0, dy, target, &unused, stats)) {
+            *jump_point = (cell_t){x, y};
+            return true;
+        }
+        x += dx;
+        y += dy;
+    }
+    return false;
+}
+
+void add_jump_point(node_list_t* list, const grid_t* grid, cell_t cell, int dx, int dy, cell_t target, path_stats_t* stats) {
+    cell_t jump_point;
+    if (jump(grid, (cell_t){cell.x+dx, cell.y+dy}, dx, dy, target, &jump_point, stats)) {
+        add_neighbour(list, jump_point, octile_cost(cell, jump_point));
+    }
+}
+
+void add_jump_points(node_list_t* list, const grid_t* grid, cell_t cell, node_t parent, cell_t target, path_stats_t* stats) {
+    const int x = cell.x;
+    const int y = cell.y;
+    if (is_empty(parent)) {
+        // Start node: every direction has to be explored
+        for (int dy=-1; dy<=1; dy++) {
+            for (int dx=-1; dx<=1; dx++) {
+                if (dx != 0 || dy != 0) {
+                    add_jump_point(list, grid, cell, dx, dy, target, stats);
+                }
+            }
+        }
+        return;
+    }
+
+    // Natural and forced neighbours, given the direction we came from
+    const cell_t from = get_record(parent)->cell;
+    const int dx = sign(x - from.x);
+    const int dy = sign(y - from.y);
+    if (dx != 0 && dy != 0) {
+        add_jump_point(list, grid, cell, 0, dy, target, stats);
+        add_jump_point(list, grid, cell, dx, 0, target, stats);
+        add_jump_point(list, grid, cell, dx, dy, target, stats);
+        if (!is_open_cell(grid, x-dx, y)) {
+            add_jump_point(list, grid, cell, -dx, dy, target, stats);
+        }
+        if (!is_open_cell(grid, x, y-dy)) {
+            add_jump_point(list, grid, cell, dx, -dy, target, stats);
+        }
+    } else if (dx == 0) {
+        add_jump_point(list, grid, cell, 0, dy, target, stats);
+        if (!is_open_cell(grid, x+1, y)) {
+            add_jump_point(list, grid, cell, 1, dy, target, stats);
+        }
+        if (!is_open_cell(grid, x-1, y)) {
+            add_jump_point(list, grid, cell, -1, dy, target, stats);
+        }
+    } else {
+        add_jump_point(list, grid, cell, dx, 0, target, stats);
+        if (!is_open_cell(grid, x, y+1)) {
+            add_jump_point(list, grid, cell, dx, 1, target, stats);
+        }
+        if (!is_open_cell(grid, x, y-1)) {
+            add_jump_point(list, grid, cell, dx, -1, target, stats);
+        }
+    }
+}
+
+path_t* find_path_with(path_search_t search, const grid_t* grid, cell_t start, cell_t target, int max_cost, int max_visit, path_stats_t* stats) {
+    path_stats_t local_stats = {0};
+    if (!stats) {
+        stats = &local_stats;
+    }
+    *stats = (path_stats_t){0};
+    assert(search != PATH_SEARCH_JPS || grid);
     visited_nodes_t* visited_nodes = calloc(1, sizeof(visited_nodes_t));
     node_list_t* neighbours = calloc(1, sizeof(node_list_t));
     node_t current = get_node(visited_nodes, start);
@@ -275,9 +434,14 @@ path_t* find_path(cell_t start, cell_t target, int max_cost, int max_visit) {
     while ((max_visit == -1 || remaining-- > 0) && visited_nodes->open_count > 0 && !is_target((current = make_node(visited_nodes, visited_nodes->open[0])))) {
         remove_from_open(current);
         get_record(current)->closed = true;
+        stats->expanded++;
         
         neighbours->count = 0;
-        add_neighbours(neighbours, get_record(current)->cell);
+        if (search == PATH_SEARCH_JPS) {
+            add_jump_points(neighbours, grid, get_record(current)->cell, get_parent(current), target, stats);
+        } else {
+            add_neighbours(neighbours, get_record(current)->cell);
+        }
 
         for (size_t n=0; n<neighbours->count; n++) {
             const float cost = get_record(current)->cost + neighbours->costs[n];
@@ -325,28 +489,45 @@ path_t* find_path(cell_t start, cell_t target, int max_cost, int max_visit) {
     }
     
     if (is_target(current)) {
-        size_t count = 0;
+        // Jump points are joined by straight or diagonal runs, which are expanded so that consecutive cells are always adjacent
+        size_t count = 1;
         node_t n = current;
+        node_t parent;
         
-        while (!is_empty(n)) {
-            count++;
-            n = get_parent(n);
+        while (!is_empty(parent = get_parent(n))) {
+            const cell_t from = get_record(parent)->cell;
+            const cell_t to = get_record(n)->cell;
+            const int dx = abs(to.x - from.x);
+            const int dy = abs(to.y - from.y);
+            count += (dx > dy) ? dx : dy;
+            n = parent;
         }
         
         path = malloc(sizeof(path_t) + (count * sizeof(cell_t)));
         path->count = count;
         path->cost = get_record(current)->cost;
-        cell_t best_cell = get_record(best)->cell;
-        path->incomplete = (target.x != best_cell.x || target.y != best_cell.y);
+        cell_t end_cell = get_record(current)->cell;
+        path->incomplete = (target.x != end_cell.x || target.y != end_cell.y);
 
         n = current;
-        for (size_t i=count; i>0; i--) {
+        size_t i = count;
+        while (!is_empty(n)) {
             cell_t v = get_record(n)->cell;
-            memcpy(path->cells + (i - 1), &v, sizeof(cell_t));
-            n = get_parent(n);
+            parent = get_parent(n);
+            const cell_t from = is_empty(parent) ? v : get_record(parent)->cell;
+            const int dx = sign(from.x - v.x);
+            const int dy = sign(from.y - v.y);
+            do {
+                memcpy(path->cells + (--i), &v, sizeof(cell_t));
+                v.x += dx;
+                v.y += dy;
+            } while (v.x != from.x || v.y != from.y);
+            n = parent;
         }
     }
     
+    stats->generated = visited_nodes->records_count;
+
     free(neighbours->costs);
     free(neighbours->cells);
     free(neighbours);
@@ -358,6 +539,10 @@ path_t* find_path(cell_t start, cell_t target, int max_cost, int max_visit) {
     return path;
 }
 
+path_t* find_path(cell_t start, cell_t target, int max_cost, int max_visit) {
+    return find_path_with(PATH_SEARCH_ASTAR, NULL, start, target, max_cost, max_visit, NULL);
+}
+
 void free_path(path_t* path) {
     free(path);
 }
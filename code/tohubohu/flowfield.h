@@ -0,0 +1,149 @@
+// Distance fields towards static targets, so that AI players can walk down the
+// gradient instead of running a full A* search each time they need waypoints.
+
+#ifndef __FLOWFIELD_H
+#define __FLOWFIELD_H
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "astar.h"
+
+#define FLOW_UNREACHABLE 0xFFFF
+// Edge costs from add_neighbours() are scaled to integers (1 -> 5, 1.414 -> 7)
+#define FLOW_COST_SCALE 5
+
+typedef struct {
+    int width;
+    int height;
+    cell_t target;
+    uint16_t distances[];
+} flow_field_t;
+
+typedef struct {
+    size_t capacity;
+    size_t count;
+    uint32_t* keys;     // (distance << 16) | cell index
+} flow_heap_t;
+
+
+void flow_heap_push(flow_heap_t* heap, uint32_t key) {
+    if (heap->count == heap->capacity) {
+        heap->capacity = 1 + (heap->capacity * 2);
+        heap->keys = realloc(heap->keys, heap->capacity * sizeof(uint32_t));
+    }
+    size_t index = heap->count++;
+    while (index > 0) {
+        const size_t parent = (index - 1) / 2;
+        if (heap->keys[parent] <= key) {
+            break;
+        }
+        heap->keys[index] = heap->keys[parent];
+        index = parent;
+    }
+    heap->keys[index] = key;
+}
+
+uint32_t flow_heap_pop(flow_heap_t* heap) {
+    const uint32_t top = heap->keys[0];
+    const uint32_t last = heap->keys[--heap->count];
+    size_t index = 0;
+    while (true) {
+        size_t child = (2 * index) + 1;
+        if (child >= heap->count) {
+            break;
+        }
+        if (child + 1 < heap->count && heap->keys[child + 1] < heap->keys[child]) {
+            child++;
+        }
+        if (last <= heap->keys[child]) {
+            break;
+        }
+        heap->keys[index] = heap->keys[child];
+        index = child;
+    }
+    if (heap->count > 0) {
+        heap->keys[index] = last;
+    }
+    return top;
+}
+
+// Dijkstra from the target over the walkable cells: each cell ends up holding its cost to reach the target
+flow_field_t* build_flow_field(int width, int height, cell_t target) {
+    assert(width * height <= 0x10000);
+    flow_field_t* field = malloc(sizeof(flow_field_t) + (width * height * sizeof(uint16_t)));
+    field->width = width;
+    field->height = height;
+    field->target = target;
+    memset(field->distances, 0xFF, width * height * sizeof(uint16_t));
+
+    if (target.x < 0 || target.x >= width || target.y < 0 || target.y >= height) {
+        return field;
+    }
+
+    flow_heap_t heap = {0};
+    node_list_t neighbours = {0};
+    field->distances[target.y*width+target.x] = 0;
+    flow_heap_push(&heap, target.y*width+target.x);
+
+    while (heap.count > 0) {
+        const uint32_t key = flow_heap_pop(&heap);
+        const uint16_t distance = key >> 16;
+        const int index = key & 0xFFFF;
+        if (distance != field->distances[index]) {
+            // Stale entry, the cell was reached by a cheaper route since it was pushed
+            continue;
+        }
+        neighbours.count = 0;
+        add_neighbours(&neighbours, (cell_t){index % width, index / width});
+        for (size_t n=0; n<neighbours.count; n++) {
+            const cell_t cell = neighbours.cells[n];
+            const uint32_t cost = distance + (uint32_t)(neighbours.costs[n] * FLOW_COST_SCALE + 0.5f);
+            uint16_t* neighbour = &field->distances[cell.y*width+cell.x];
+            if (cost < *neighbour) {
+                *neighbour = cost;
+                flow_heap_push(&heap, (cost << 16) | (cell.y*width+cell.x));
+            }
+        }
+    }
+
+    free(neighbours.costs);
+    free(neighbours.cells);
+    free(heap.keys);
+    return field;
+}
+
+void free_flow_field(flow_field_t* field) {
+    free(field);
+}
+
+uint16_t get_flow_distance(flow_field_t* field, cell_t cell) {
+    if (cell.x < 0 || cell.x >= field->width || cell.y < 0 || cell.y >= field->height) {
+        return FLOW_UNREACHABLE;
+    }
+    return field->distances[cell.y*field->width+cell.x];
+}
+
+// Step to the neighbour closest to the target, returns false once on the target or when stuck
+bool get_flow_next(flow_field_t* field, node_list_t* neighbours, cell_t from, cell_t* next) {
+    uint16_t best = get_flow_distance(field, from);
+    if (best == 0) {
+        return false;
+    }
+    bool found = false;
+    neighbours->count = 0;
+    add_neighbours(neighbours, from);
+    for (size_t n=0; n<neighbours->count; n++) {
+        const uint16_t distance = get_flow_distance(field, neighbours->cells[n]);
+        if (distance < best) {
+            best = distance;
+            *next = neighbours->cells[n];
+            found = true;
+        }
+    }
+    return found;
+}
+
+#endif
@@ -1,6 +1,8 @@
 #include "game.h"
 #include "astar.h"
+#include "flowfield.h"
 #include "../../core.h"
+#include "../../assetcache.h"
 #include "../../minigame.h"
 #include <t3d/t3d.h>
 #include <t3d/t3dmodel.h>
@@ -9,6 +11,7 @@
 
 #define ENABLE_TEXT 1
 #define ENABLE_WIREFRAME 1
+#define ENABLE_PATH_STATS 0
 
 #if ENABLE_WIREFRAME
 #include "draw.h"
@@ -28,6 +31,7 @@
 #define MAP_REDUCTION_FACTOR 4
 #define MAX_PATH_VISIT 500
 #define PATH_8_WAYS 1
+#define PATH_SEARCH (PATH_8_WAYS ? PATH_SEARCH_JPS : PATH_SEARCH_ASTAR)
 #define PATH_LOOKUP 30
 #define PATH_LENGTH 10
 #define NO_PATH 9999
@@ -136,6 +140,7 @@ typedef struct {
     bool vaults[VAULTS_COUNT];
     int target_idx;
     T3DVec3 target;
+    flow_field_t* flow;         // Distance field towards a static target, NULL when chasing a player
     T3DVec3 path[PATH_LENGTH];  // Next points in path
     int path_pos;
     int path_lookup;
@@ -203,7 +208,19 @@ c2AABB actor_bounding_box(actor_t* actor) {
 int map_width;
 int map_height;
 T3DVec3 origin;
-char* map;
+grid_t* pathgrid;
+
+// Static targets never move, so their distance fields are computed once
+flow_field_t* furniture_flows[FURNITURES_COUNT];
+flow_field_t* vault_flows[VAULTS_COUNT];
+node_list_t flow_neighbours;
+
+#if ENABLE_PATH_STATS
+uint64_t path_stats_ticks[2];
+uint32_t path_stats_calls[2];
+uint64_t path_stats_expanded;
+uint32_t path_stats_incomplete;
+#endif
 
 inline static void to_pathmap_coords(T3DVec3 *res, const T3DVec3 *a) {
     t3d_vec3_scale(res, a, 1.0f/MAP_REDUCTION_FACTOR);
@@ -215,100 +232,92 @@ inline static void from_pathmap_coords(T3DVec3 *res, const T3DVec3 *a) {
     t3d_vec3_scale(res, res, MAP_REDUCTION_FACTOR);
 }
 
+grid_rect_t to_pathmap_rect(float min_x, float min_z, float max_x, float max_z) {
+    // World coordinates in, cells overlapped by the strict interior of the rectangle out
+    T3DVec3 min = (T3DVec3){{min_x, 0, min_z}};
+    to_pathmap_coords(&min, &min);
+    T3DVec3 max = (T3DVec3){{max_x, 0, max_z}};
+    to_pathmap_coords(&max, &max);
+    return (grid_rect_t){(int)(min.v[0]+1), (int)(min.v[2]+1), (int)ceilf(max.v[0]), (int)ceilf(max.v[2])};
+}
+
+grid_rect_t to_pathmap_span(float min_x, float min_z, float max_x, float max_z) {
+    // World coordinates in, cells containing both corners of the rectangle out
+    T3DVec3 min = (T3DVec3){{min_x, 0, min_z}};
+    to_pathmap_coords(&min, &min);
+    T3DVec3 max = (T3DVec3){{max_x, 0, max_z}};
+    to_pathmap_coords(&max, &max);
+    return (grid_rect_t){(int)min.v[0], (int)min.v[2], (int)max.v[0] + 1, (int)max.v[2] + 1};
+}
+
+// Margin around walls and obstacles to account for players width
+float obstacle_margin() {
+    return ((players[0].w/2.0f) / MAP_REDUCTION_FACTOR) + 2;
+}
+
+grid_rect_t usable_actor_obstacle(usable_actor_t* actor) {
+    float margin = obstacle_margin();
+    return to_pathmap_rect(actor->bbox.min.x-margin, actor->bbox.min.y-margin, actor->bbox.max.x+margin, actor->bbox.max.y+margin);
+}
+
 void update_obstacles() {
     // Precompute obstacles in map coordinates (is_walkable takes 150-400 cyces vs 4000+ when computing on-the-fly)
-    // Margin around walls and obstacles to account for players width
-    float margin = ((players[0].w/2.0f) / MAP_REDUCTION_FACTOR) + 2;
+    grid_clear(pathgrid);
+    float margin = obstacle_margin();
+    int inner = ceilf(margin) - 1;      // Last world unit covered by the wall margins
+    float left = -room.w/2;
+    float top = -room.h/2;
     // Walls
-    for (int x=0; x<margin; x++) {
-        for (int y=0; y<room.h; y++) {
-            T3DVec3 coords = (T3DVec3){{-room.w/2+x, 0, -room.h/2+y}};
-            to_pathmap_coords(&coords, &coords);
-            *(map+((int)coords.v[2])*map_width+((int)coords.v[0])) = 1;
-        }
-    }
-    for (int x=room.w; x>room.w-margin; x--) {
-        for (int y=0; y<room.h; y++) {
-            T3DVec3 coords = (T3DVec3){{-room.w/2+x, 0, -room.h/2+y}};
-            to_pathmap_coords(&coords, &coords);
-            *(map+((int)coords.v[2])*map_width+((int)coords.v[0])) = 1;
-        }
-    }
-    for (int y=0; y<margin; y++) {
-        for (int x=0; x<room.w; x++) {
-            T3DVec3 coords = (T3DVec3){{-room.w/2+x, 0, -room.h/2+y}};
-            to_pathmap_coords(&coords, &coords);
-            *(map+((int)coords.v[2])*map_width+((int)coords.v[0])) = 1;
-        }
-    }
-    for (int y=room.h; y>room.h-margin; y--) {
-        for (int x=0; x<room.w; x++) {
-            T3DVec3 coords = (T3DVec3){{-room.w/2+x, 0, -room.h/2+y}};
-            to_pathmap_coords(&coords, &coords);
-            *(map+((int)coords.v[2])*map_width+((int)coords.v[0])) = 1;
-        }
-    }
+    grid_add_obstacle(pathgrid, to_pathmap_span(left, top, left+inner, top+room.h-1));
+    grid_add_obstacle(pathgrid, to_pathmap_span(left+room.w-inner, top, left+room.w, top+room.h-1));
+    grid_add_obstacle(pathgrid, to_pathmap_span(left, top, left+room.w-1, top+inner));
+    grid_add_obstacle(pathgrid, to_pathmap_span(left, top+room.h-inner, left+room.w-1, top+room.h));
     // Furnitures
     for (int i=0; i<FURNITURES_COUNT; i++) {
-        T3DVec3 furniture_min = (T3DVec3){{furnitures[i].bbox.min.x-margin, 0, furnitures[i].bbox.min.y-margin}};
-        to_pathmap_coords(&furniture_min, &furniture_min);
-        T3DVec3 furniture_max = (T3DVec3){{furnitures[i].bbox.max.x+margin, 0, furnitures[i].bbox.max.y+margin}};
-        to_pathmap_coords(&furniture_max, &furniture_max);
-        for (int x=furniture_min.v[0]+1; x<furniture_max.v[0]; x++) {
-            for (int y=furniture_min.v[2]+1; y<furniture_max.v[2]; y++) {
-                if (x >= 0 && x < map_width && y >= 0 && y < map_height) {
-                    *(map+y*map_width+x) = 1;
-                }
-            }
-        }
+        grid_add_obstacle(pathgrid, usable_actor_obstacle((usable_actor_t*)&furnitures[i]));
     }
     // Vaults
     for (int i=0; i<VAULTS_COUNT; i++) {
-        T3DVec3 vault_min = (T3DVec3){{vaults[i].bbox.min.x-margin, 0, vaults[i].bbox.min.y-margin}};
-        to_pathmap_coords(&vault_min, &vault_min);
-        T3DVec3 vault_max = (T3DVec3){{vaults[i].bbox.max.x+margin, 0, vaults[i].bbox.max.y+margin}};
-        to_pathmap_coords(&vault_max, &vault_max);
-        for (int x=vault_min.v[0]+1; x<vault_max.v[0]; x++) {
-            for (int y=vault_min.v[2]+1; y<vault_max.v[2]; y++) {
-                if (x >= 0 && x < map_width && y >= 0 && y < map_height) {
-                    *(map+y*map_width+x) = 1;
-                }
-            }
-        }
+        grid_add_obstacle(pathgrid, usable_actor_obstacle((usable_actor_t*)&vaults[i]));
     }
 }
 
 bool is_walkable(cell_t cell) {
-    bool walkable = (cell.x >= 0 && cell.x < map_width && cell.y >= 0 && cell.y < map_height);
-    if (walkable) {
-        return *(map+cell.y*map_width+cell.x) != 1;
-    }
-    return walkable;
+    return !grid_is_blocked(pathgrid, cell.x, cell.y);
 }
 
 void add_neighbours(node_list_t* list, cell_t cell) {
-    for (int x=cell.x-1; x<=cell.x+1; x++) {
-        for (int y=cell.y-1; y<=cell.y+1; y++) {
-            if ((x != cell.x || y != cell.y) && is_walkable((cell_t){x, y})) {
-#if PATH_8_WAYS
-                float cost = (x == cell.x || y == cell.y) ? 1 : 1.414;
-                add_neighbour(list, (cell_t){x, y}, cost);
-#else
-                if (x == cell.x || y == cell.y) {
-                    add_neighbour(list, (cell_t){x, y}, 1);
-                }
-#endif
-            }
-        }
-    }
+    add_grid_neighbours(list, pathgrid, cell, PATH_8_WAYS);
 }
 
 float heuristic(cell_t from, cell_t to) {
-    // Manhattan distance
-    return (fabs(from.x - to.x) + fabs(from.y - to.y));
+    // Octile distance, the exact cost on an open 8-way grid, so it never overestimates
+    return octile_cost(from, to);
+}
+
+flow_field_t* build_target_flow_field(const T3DVec3* target) {
+    T3DVec3 coords;
+    to_pathmap_coords(&coords, target);
+    return build_flow_field(map_width, map_height, (cell_t){(int)coords.v[0], (int)coords.v[2]});
+}
+
+void update_flow_fields() {
+    // Must run after update_obstacles, as the fields only go through walkable cells
+    for (int i=0; i<FURNITURES_COUNT; i++) {
+        if (furniture_flows[i]) free_flow_field(furniture_flows[i]);
+        furniture_flows[i] = build_target_flow_field(&furnitures[i].zone_target);
+    }
+    for (int i=0; i<VAULTS_COUNT; i++) {
+        if (vault_flows[i]) free_flow_field(vault_flows[i]);
+        vault_flows[i] = build_target_flow_field(&vaults[i].zone_target);
+    }
 }
 
 void update_path(PlyNum i) {
+#if ENABLE_PATH_STATS
+    uint32_t ticks = get_ticks();
+    bool use_flow = (players[i].flow != NULL);
+#endif
     // Clear path
     for (int j=0; j<PATH_LENGTH; j++) {
         players[i].path[j].v[0] = NO_PATH;
@@ -322,22 +331,60 @@ void update_path(PlyNum i) {
     to_pathmap_coords(&target, &players[i].target);
     cell_t start_node = {(int)start.v[0], (int)start.v[2]};
     cell_t target_node = {(int)target.v[0], (int)target.v[2]};
-    path_t* path = find_path(start_node, target_node, players[i].path_lookup, MAX_PATH_VISIT);
-    if (get_path_count(path) > 1) {
-        // Keep fewer waypoints when chasing a player
-        int keep = players[i].state == MOVING_TO_PLAYER ? players[i].path_keep_chase : players[i].path_keep;
-        for (int j=0; j<get_path_count(path); j++) {
-            if (players[i].path_pos >= keep)   break;
-            cell_t* node = get_path_cell(path, j);
-            players[i].path[players[i].path_pos].v[0] = node->x;
-            players[i].path[players[i].path_pos].v[2] = node->y;
-            players[i].path_pos++;
+    if (players[i].flow) {
+        // Static target: walk down the distance field, one neighbourhood lookup per waypoint
+        cell_t node = start_node;
+        int keep = players[i].path_keep;
+        if (get_flow_next(players[i].flow, &flow_neighbours, node, &node)) {
+            players[i].path[0].v[0] = start_node.x;
+            players[i].path[0].v[2] = start_node.y;
+            players[i].path_pos = 1;
+            do {
+                players[i].path[players[i].path_pos].v[0] = node.x;
+                players[i].path[players[i].path_pos].v[2] = node.y;
+                players[i].path_pos++;
+            } while (players[i].path_pos < keep && get_flow_next(players[i].flow, &flow_neighbours, node, &node));
+            players[i].path_pos = 0;
+        } else {
+            debugf("No flow from %d %d to %d %d\n", start_node.x, start_node.y, target_node.x, target_node.y);
         }
-        players[i].path_pos = 0;
     } else {
-        debugf("No path from %d %d to %d %d\n", start_node.x, start_node.y, target_node.x, target_node.y);
+        path_stats_t stats;
+        path_t* path = find_path_with(PATH_SEARCH, pathgrid, start_node, target_node, players[i].path_lookup, MAX_PATH_VISIT, &stats);
+#if ENABLE_PATH_STATS
+        path_stats_expanded += stats.expanded;
+        path_stats_incomplete += !get_path_complete(path);
+#endif
+        if (get_path_count(path) > 1) {
+            // Keep fewer waypoints when chasing a player
+            int keep = players[i].state == MOVING_TO_PLAYER ? players[i].path_keep_chase : players[i].path_keep;
+            for (int j=0; j<get_path_count(path); j++) {
+                if (players[i].path_pos >= keep)   break;
+                cell_t* node = get_path_cell(path, j);
+                players[i].path[players[i].path_pos].v[0] = node->x;
+                players[i].path[players[i].path_pos].v[2] = node->y;
+                players[i].path_pos++;
+            }
+            players[i].path_pos = 0;
+        } else {
+            debugf("No path from %d %d to %d %d\n", start_node.x, start_node.y, target_node.x, target_node.y);
+        }
+        free_path(path);
     }
-    free_path(path);
+#if ENABLE_PATH_STATS
+    path_stats_ticks[use_flow] += get_ticks() - ticks;
+    if (++path_stats_calls[use_flow] % 50 == 0) {
+        // The COUNT register ticks at half the CPU clock
+        debugf("update_path (%s): %u calls, %llu cycles per call\n",
+            use_flow ? "flow field" : "grid search", (unsigned int)path_stats_calls[use_flow],
+            (unsigned long long)(path_stats_ticks[use_flow] * 2 / path_stats_calls[use_flow]));
+        if (!use_flow) {
+            debugf("update_path (%s): %llu nodes expanded per call, %u incomplete paths\n",
+                PATH_SEARCH == PATH_SEARCH_JPS ? "JPS" : "A*",
+                (unsigned long long)(path_stats_expanded / path_stats_calls[use_flow]), (unsigned int)path_stats_incomplete);
+        }
+    }
+#endif
 }
 
 bool has_waypoints(PlyNum i) {
@@ -695,6 +742,7 @@ void game_init()
             memset(&players[i].vaults, 0, sizeof(bool) * FURNITURES_COUNT);
             players[i].target_idx = -1;
             players[i].target = (T3DVec3){{NO_PATH, 0, NO_PATH}};
+            players[i].flow = NULL;
             for (int j=0; j<PATH_LENGTH; j++) {
                 players[i].path[j].v[0] = NO_PATH;
                 players[i].path[j].v[1] = 0;
@@ -730,7 +778,7 @@ void game_init()
 
 #if ENABLE_TEXT
     // Init fonts
-    fontbill = rdpq_font_load("rom:/squarewave.font64");
+    fontbill = assetcache_get_font(ASSETCACHE_FONT_SQUAREWAVE);
     rdpq_text_register_font(FONT_BILLBOARD, fontbill);
     for (size_t i = 0; i < MAXPLAYERS; i++) {
         rdpq_font_style(fontbill, i, &(rdpq_fontstyle_t){ .color = colors[i] });
@@ -741,8 +789,9 @@ void game_init()
     map_width = (room.w/MAP_REDUCTION_FACTOR) + 1;
     map_height = (room.h/MAP_REDUCTION_FACTOR) + 1;
     origin = (T3DVec3){{-map_width/2.0f, 0, -map_height/2.0f}};
-    map = calloc(1, sizeof(char) * map_width * map_height);
+    pathgrid = grid_create(map_width, map_height);
     update_obstacles();
+    update_flow_fields();
 }
 
 
@@ -842,6 +891,7 @@ void game_logic(float deltatime)
                                 players[i].target_idx = target_idx;
                                 // Go to a point in front of the vault
                                 players[i].target = vaults[target_idx].zone_target;
+                                players[i].flow = vault_flows[target_idx];
                                 //debugf("Player #%d now targeting vault #%d at coords: %f %f\n", i, target_idx, players[i].target.v[0], players[i].target.v[2]);
                                 next_state = MOVING_TO_VAULT;
                             } else {
@@ -851,6 +901,7 @@ void game_logic(float deltatime)
                                 players[i].target.v[0] = players[target_idx].position.v[0];
                                 players[i].target.v[1] = players[target_idx].position.v[1];
                                 players[i].target.v[2] = players[target_idx].position.v[2];
+                                players[i].flow = NULL;
                                 //debugf("Player #%d now targeting player #%d at coords: %f %f\n", i, target_idx, players[i].target.v[0], players[i].target.v[2]);
                                 next_state = MOVING_TO_PLAYER;
                             }
@@ -863,6 +914,7 @@ void game_logic(float deltatime)
                             players[i].target_idx = target_idx;
                             // Go to a point in front of the furniture
                             players[i].target = furnitures[target_idx].zone_target;
+                            players[i].flow = furniture_flows[target_idx];
                             //debugf("Player #%d now targeting furniture #%d at coords: %f %f\n", i, target_idx, players[i].target.v[0], players[i].target.v[2]);
                             next_state = MOVING_TO_FURNITURE;
                         }
@@ -1183,7 +1235,7 @@ void game_render_gl(float deltatime)
     /*
     for (int x=0; x<map_width; x++) {
         for (int y=0; y<map_height; y++) {
-            char walkable = *(map+y*map_width+x) == 0;
+            bool walkable = is_walkable((cell_t){x, y});
             T3DVec3 point = (T3DVec3){{x, 0, y}};
             from_pathmap_coords(&point, &point);
             float r = 1.0f;
@@ -1284,11 +1336,22 @@ void game_render_gl(float deltatime)
 
 void game_cleanup()
 {
-    free(map);
+    for (int i=0; i<FURNITURES_COUNT; i++) {
+        free_flow_field(furniture_flows[i]);
+        furniture_flows[i] = NULL;
+    }
+    for (int i=0; i<VAULTS_COUNT; i++) {
+        free_flow_field(vault_flows[i]);
+        vault_flows[i] = NULL;
+    }
+    free(flow_neighbours.costs);
+    free(flow_neighbours.cells);
+    flow_neighbours = (node_list_t){0};
+    grid_free(pathgrid);
 
 #if ENABLE_TEXT
     rdpq_text_unregister_font(FONT_BILLBOARD);
-    rdpq_font_free(fontbill);
+    assetcache_release_font(fontbill);
 #endif
 
     wav64_close(&sfx_key);
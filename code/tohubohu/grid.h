@@ -0,0 +1,113 @@
+// Bit-packed occupancy grid used by the path finder.
+// Cells are stored one bit each (1 = blocked) with a blocked border of one cell
+// all around, so that looking at the neighbours of any cell in the grid never
+// needs a bounds check.
+
+#ifndef __GRID_H
+#define __GRID_H
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define GRID_PADDING 1
+
+// Cell rectangle, min inclusive and max exclusive
+typedef struct {
+    int min_x;
+    int min_y;
+    int max_x;
+    int max_y;
+} grid_rect_t;
+
+typedef struct {
+    int width;
+    int height;
+    int stride;         // Words per row, border included
+    uint32_t* bits;
+} grid_t;
+
+
+void grid_fill_words(grid_t* grid, int min_x, int min_y, int max_x, int max_y, bool blocked) {
+    // Coordinates are already offset by the border
+    if (min_x >= max_x || min_y >= max_y) {
+        return;
+    }
+    const int first_word = min_x >> 5;
+    const int last_word = (max_x - 1) >> 5;
+    const uint32_t first_mask = 0xFFFFFFFFu << (min_x & 31);
+    const uint32_t last_mask = 0xFFFFFFFFu >> (31 - ((max_x - 1) & 31));
+    for (int y=min_y; y<max_y; y++) {
+        uint32_t* row = grid->bits + y*grid->stride;
+        if (first_word == last_word) {
+            const uint32_t mask = first_mask & last_mask;
+            row[first_word] = blocked ? (row[first_word] | mask) : (row[first_word] & ~mask);
+            continue;
+        }
+        row[first_word] = blocked ? (row[first_word] | first_mask) : (row[first_word] & ~first_mask);
+        for (int w=first_word+1; w<last_word; w++) {
+            row[w] = blocked ? 0xFFFFFFFFu : 0;
+        }
+        row[last_word] = blocked ? (row[last_word] | last_mask) : (row[last_word] & ~last_mask);
+    }
+}
+
+grid_rect_t grid_clip_rect(const grid_t* grid, grid_rect_t rect) {
+    if (rect.min_x < 0) rect.min_x = 0;
+    if (rect.min_y < 0) rect.min_y = 0;
+    if (rect.max_x > grid->width) rect.max_x = grid->width;
+    if (rect.max_y > grid->height) rect.max_y = grid->height;
+    return rect;
+}
+
+// Set or clear a rectangle of cells, clipped to the grid (the border is never touched)
+void grid_fill_rect(grid_t* grid, grid_rect_t rect, bool blocked) {
+    rect = grid_clip_rect(grid, rect);
+    grid_fill_words(grid,
+        rect.min_x + GRID_PADDING, rect.min_y + GRID_PADDING,
+        rect.max_x + GRID_PADDING, rect.max_y + GRID_PADDING,
+        blocked);
+}
+
+void grid_clear(grid_t* grid) {
+    const int padded_width = grid->width + 2*GRID_PADDING;
+    const int padded_height = grid->height + 2*GRID_PADDING;
+    memset(grid->bits, 0, grid->stride * padded_height * sizeof(uint32_t));
+    grid_fill_words(grid, 0, 0, padded_width, GRID_PADDING, true);
+    grid_fill_words(grid, 0, padded_height - GRID_PADDING, padded_width, padded_height, true);
+    grid_fill_words(grid, 0, 0, GRID_PADDING, padded_height, true);
+    grid_fill_words(grid, padded_width - GRID_PADDING, 0, padded_width, padded_height, true);
+}
+
+grid_t* grid_create(int width, int height) {
+    grid_t* grid = calloc(1, sizeof(grid_t));
+    grid->width = width;
+    grid->height = height;
+    grid->stride = (width + 2*GRID_PADDING + 31) / 32;
+    grid->bits = malloc(grid->stride * (height + 2*GRID_PADDING) * sizeof(uint32_t));
+    grid_clear(grid);
+    return grid;
+}
+
+void grid_free(grid_t* grid) {
+    if (grid) {
+        free(grid->bits);
+        free(grid);
+    }
+}
+
+// Valid for any cell in the grid or in its border
+bool grid_is_blocked(const grid_t* grid, int x, int y) {
+    x += GRID_PADDING;
+    y += GRID_PADDING;
+    assert(x >= 0 && x < grid->width + 2*GRID_PADDING && y >= 0 && y < grid->height + 2*GRID_PADDING);
+    return (grid->bits[y*grid->stride + (x >> 5)] >> (x & 31)) & 1;
+}
+
+void grid_add_obstacle(grid_t* grid, grid_rect_t rect) {
+    grid_fill_rect(grid, rect, true);
+}
+
+#endif
@@ -1,5 +1,6 @@
 #include <libdragon.h>
 #include "../../core.h"
+#include "../../assetcache.h"
 #include "../../minigame.h"
 #include "game.h"
 #include <t3d/t3d.h>
@@ -52,10 +53,10 @@ T3DVec3 lightDirVec;
 rdpq_font_t* fontdbg;
 rdpq_font_t *fonttext;
 wav64_t music;
-wav64_t sfx_start;
-wav64_t sfx_countdown;
-wav64_t sfx_stop;
-wav64_t sfx_winner;
+wav64_t* sfx_start;
+wav64_t* sfx_countdown;
+wav64_t* sfx_stop;
+wav64_t* sfx_winner;
 
 int menu_option;
 float menu_time;
@@ -119,10 +120,10 @@ void minigame_init()
     wav64_play(&music, 1);
 #endif
 
-    wav64_open(&sfx_start, "rom:/core/Start.wav64");
-    wav64_open(&sfx_countdown, "rom:/core/Countdown.wav64");
-    wav64_open(&sfx_stop, "rom:/core/Stop.wav64");
-    wav64_open(&sfx_winner, "rom:/core/Winner.wav64");
+    sfx_start = assetcache_get_sound(ASSETCACHE_SFX_START);
+    sfx_countdown = assetcache_get_sound(ASSETCACHE_SFX_COUNTDOWN);
+    sfx_stop = assetcache_get_sound(ASSETCACHE_SFX_STOP);
+    sfx_winner = assetcache_get_sound(ASSETCACHE_SFX_WINNER);
 
     game_init();
     
@@ -148,25 +149,25 @@ void minigame_fixedloop(float deltatime)
             float prev = countdown_timer;
             countdown_timer -= deltatime;
             if ((int)prev != (int)countdown_timer && countdown_timer >= 0) {
-                wav64_play(&sfx_countdown, 31);
+                wav64_play(sfx_countdown, 31);
             }
         }
         if (!is_playing() && !is_ending && countdown_timer < 0) {
             start_game();
-            wav64_play(&sfx_start, 31);
+            wav64_play(sfx_start, 31);
         }
 
         if (!is_ending) {
             if (has_winner()) {
                 is_ending = true;
                 stop_game();
-                wav64_play(&sfx_stop, 31);
+                wav64_play(sfx_stop, 31);
             }
         } else {
             float prev = end_timer;
             end_timer += deltatime;
             if ((int)prev != (int)end_timer && (int)end_timer == WIN_SHOW_DELAY) {
-                wav64_play(&sfx_winner, 31);
+                wav64_play(sfx_winner, 31);
             }
             if (end_timer > WIN_DELAY) {
                 core_set_winner(winner());
@@ -316,10 +317,10 @@ void minigame_cleanup()
 #if ENABLE_MUSIC
     wav64_close(&music);
 #endif
-    wav64_close(&sfx_start);
-    wav64_close(&sfx_countdown);
-    wav64_close(&sfx_stop);
-    wav64_close(&sfx_winner);
+    assetcache_release_sound(sfx_start);
+    assetcache_release_sound(sfx_countdown);
+    assetcache_release_sound(sfx_stop);
+    assetcache_release_sound(sfx_winner);
 #if ENABLE_TEXT
     rdpq_text_unregister_font(FONT_DEBUG);
     rdpq_font_free(fontdbg);
@@ -1,6 +1,7 @@
 #include <libdragon.h>
 #include "../../minigame.h"
 #include "../../core.h"
+#include "../../assetcache.h"
 #include <t3d/t3d.h>
 #include <t3d/t3dmath.h>
 #include <t3d/t3dmodel.h>
@@ -55,6 +56,7 @@ T3DModel *snakeModel;
 T3DModel *shadowModel;
 T3DModel *modelMap;
 T3DModel *dirtBlockModel;
+InstanceBatch dirtBlockBatch;
 T3DModel *chestModel;
 T3DVec3 camPos;
 T3DVec3 camTarget;
@@ -75,10 +77,10 @@ float endTimer;
 PlyNum winner;
 int blockGridSize;
 
-wav64_t sfx_start;
-wav64_t sfx_countdown;
-wav64_t sfx_stop;
-wav64_t sfx_winner;
+wav64_t* sfx_start;
+wav64_t* sfx_countdown;
+wav64_t* sfx_stop;
+wav64_t* sfx_winner;
 
 rspq_syncpoint_t syncPoint;
 
@@ -107,7 +109,7 @@ void minigame_init(void)
   rdpq_text_register_font(FONT_TEXT, font);
   rdpq_font_style(font, 0, &(rdpq_fontstyle_t){.color = color_from_packed32(TEXT_COLOR) });
 
-  fontBillboard = rdpq_font_load("rom:/squarewave.font64");
+  fontBillboard = assetcache_get_font(ASSETCACHE_FONT_SQUAREWAVE);
   rdpq_text_register_font(FONT_BILLBOARD, fontBillboard);
   for (size_t i = 0; i < MAXPLAYERS; i++)
   {
@@ -132,6 +134,7 @@ void minigame_init(void)
   snakeModel = t3d_model_load("rom:/undergroundgrind/snake.t3dm");
   
   dirtBlockModel = t3d_model_load("rom:/undergroundgrind/one-by-one.t3dm");
+  instancing_init(&dirtBlockBatch, dirtBlockModel, NULL, TOTAL_BLOCKS, true);
 
   chestModel = t3d_model_load("rom:/undergroundgrind/chest.t3dm");
 
@@ -178,7 +181,7 @@ void minigame_init(void)
   
   for (size_t i = 0; i < TOTAL_BLOCKS; i++)
   {
-  	initDirtBlock(&dirtBlocks[i], dirtBlockModel, blockScale, RGBA32(255, 0, 0, 255), blockPositions[i]);
+  	initDirtBlock(&dirtBlocks[i], &dirtBlockBatch, i, blockScale, RGBA32(255, 0, 0, 255), blockPositions[i]);
   }
 
   initChest(&chests[0], chestModel, 0.4f, RGBA32(255, 0, 0, 255), blockPositions[chestBlockNumber], chestBlockNumber);
@@ -188,10 +191,10 @@ void minigame_init(void)
   countDownTimer = COUNTDOWN_DELAY;
 
   syncPoint = 0;
-  wav64_open(&sfx_start, "rom:/core/Start.wav64");
-  wav64_open(&sfx_countdown, "rom:/core/Countdown.wav64");
-  wav64_open(&sfx_stop, "rom:/core/Stop.wav64");
-  wav64_open(&sfx_winner, "rom:/core/Winner.wav64");
+  sfx_start = assetcache_get_sound(ASSETCACHE_SFX_START);
+  sfx_countdown = assetcache_get_sound(ASSETCACHE_SFX_COUNTDOWN);
+  sfx_stop = assetcache_get_sound(ASSETCACHE_SFX_STOP);
+  sfx_winner = assetcache_get_sound(ASSETCACHE_SFX_WINNER);
   xm64player_open(&music, "rom:/undergroundgrind/bottled_bubbles.xm64");
   xm64player_play(&music, 0);
 }
@@ -387,14 +390,22 @@ void player_draw(SnakePlayer *player)
   rspq_block_run(player->dplSnake);
 }
 
-void dirtBlockDraw(DirtBlock *dirtBlock)
+void dirtBlocksDraw(void)
 {
-  if (!dirtBlock->isDestroyed) {
-  	rspq_block_run(dirtBlock->dplDirtBlock);
+  // all blocks share one material setup, destroyed ones are just skipped
+  for (size_t i = 0; i < TOTAL_BLOCKS; i++)
+  {
+    instancing_set_visible(&dirtBlockBatch, dirtBlocks[i].instance, !dirtBlocks[i].isDestroyed);
   }
+  t3d_matrix_push_pos(1);
+  instancing_draw(&dirtBlockBatch, NULL);
+  t3d_matrix_pop(1);
 
-  if (dirtBlock->isDestroyed && dirtBlock->isContainingChest) {
-    rspq_block_run(chests[0].dplChestBlock);
+  for (size_t i = 0; i < TOTAL_BLOCKS; i++)
+  {
+    if (dirtBlocks[i].isDestroyed && dirtBlocks[i].isContainingChest) {
+      rspq_block_run(chests[0].dplChestBlock);
+    }
   }
 }
 
@@ -432,10 +443,10 @@ void minigame_fixedloop(float deltaTime)
     float prevCountDown = countDownTimer;
     countDownTimer -= deltaTime;
     if ((int)prevCountDown != (int)countDownTimer && countDownTimer >= 0)
-      wav64_play(&sfx_countdown, 31);
+      wav64_play(sfx_countdown, 31);
   }
   if (!controlbefore && player_has_control(&players[0]))
-    wav64_play(&sfx_start, 31);
+    wav64_play(sfx_start, 31);
 
   if (!isEnding) {
     // Determine if a player has won
@@ -451,13 +462,13 @@ void minigame_fixedloop(float deltaTime)
     if (lastPlayer != -1) {
       isEnding = true;
       winner = lastPlayer;
-      wav64_play(&sfx_stop, 31);
+      wav64_play(sfx_stop, 31);
     }
   } else {
     float prevEndTime = endTimer;
     endTimer += deltaTime;
     if ((int)prevEndTime != (int)endTimer && (int)endTimer == WIN_SHOW_DELAY)
-        wav64_play(&sfx_winner, 31);
+        wav64_play(sfx_winner, 31);
     if (endTimer > WIN_DELAY) {
       core_set_winner(winner);
       minigame_end();
@@ -497,10 +508,7 @@ void minigame_loop(float deltaTime)
     player_draw(&players[i]);
   }
 
-  for (size_t i = 0; i < TOTAL_BLOCKS; i++)
-  {
-    dirtBlockDraw(&dirtBlocks[i]);
-  }
+  dirtBlocksDraw();
 
   syncPoint = rspq_syncpoint_new();
 
@@ -534,20 +542,17 @@ void minigame_cleanup(void)
     cleanupSnakePlayer(&players[i]);
   }
 
-  for (size_t i = 0; i < TOTAL_BLOCKS; i++)
-  {
-    cleanupDirtBlock(&dirtBlocks[i]);
-  }
+  instancing_free(&dirtBlockBatch);
   
   for (size_t i = 0; i < 1; i++)
   {
     cleanupChest(&chests[i]);
   }
 
-  wav64_close(&sfx_start);
-  wav64_close(&sfx_countdown);
-  wav64_close(&sfx_stop);
-  wav64_close(&sfx_winner);
+  assetcache_release_sound(sfx_start);
+  assetcache_release_sound(sfx_countdown);
+  assetcache_release_sound(sfx_stop);
+  assetcache_release_sound(sfx_winner);
   xm64player_stop(&music);
   xm64player_close(&music);
   rspq_block_free(dplMap);
@@ -561,7 +566,7 @@ void minigame_cleanup(void)
   free_uncached(mapMatFP);
 
   rdpq_text_unregister_font(FONT_BILLBOARD);
-  rdpq_font_free(fontBillboard);
+  assetcache_release_font(fontBillboard);
   rdpq_text_unregister_font(FONT_TEXT);
   rdpq_font_free(font);
   t3d_destroy();
@@ -0,0 +1,325 @@
+/***************************************************************
+                          instancing.c
+
+Helper for minigames that draw many copies of the same static
+mesh, without recording a separate block per copy.
+***************************************************************/
+
+#include <libdragon.h>
+#include <t3d/t3d.h>
+#include <t3d/t3dmodel.h>
+#include "instancing.h"
+
+
+/*==============================
+    instancing_init
+    Creates a batch of instances of a model.
+    @param  The batch to initialize
+    @param  The model to instance
+    @param  The object to draw, or NULL for all objects
+    @param  The number of instances
+    @param  Whether every instance sets its own prim color
+==============================*/
+
+void instancing_init(InstanceBatch* batch, T3DModel* model, T3DObject* object, uint32_t count, bool usecolors)
+{
+    batch->count = count;
+
+    // Collect the objects to draw
+    if (object != NULL)
+    {
+        batch->objectcount = 1;
+        batch->objects = malloc(sizeof(T3DObject*));
+        batch->objects[0] = object;
+    }
+    else
+    {
+        batch->objectcount = 0;
+        T3DModelIter it = t3d_model_iter_create(model, T3D_CHUNK_TYPE_OBJECT);
+        while (t3d_model_iter_next(&it))
+            batch->objectcount++;
+
+        batch->objects = malloc(sizeof(T3DObject*) * batch->objectcount);
+        it = t3d_model_iter_create(model, T3D_CHUNK_TYPE_OBJECT);
+        for (int i=0; t3d_model_iter_next(&it); i++)
+            batch->objects[i] = it.object;
+    }
+
+    // Record only the geometry, materials are set once per draw call
+    batch->objectblocks = malloc(sizeof(rspq_block_t*) * batch->objectcount);
+    for (uint32_t i=0; i<batch->objectcount; i++)
+    {
+        rspq_block_begin();
+            t3d_model_draw_object(batch->objects[i], NULL);
+        batch->objectblocks[i] = rspq_block_end();
+    }
+
+    batch->matrices = malloc_uncached(sizeof(T3DMat4FP) * count);
+    batch->transforms = malloc(sizeof(float[9]) * count);
+    batch->colors = usecolors ? malloc(sizeof(color_t) * count) : NULL;
+    batch->visible = malloc(count);
+    batch->groups = malloc(count);
+
+    for (uint32_t i=0; i<count; i++)
+    {
+        // Matches the identity matrix below
+        for (int k=0; k<9; k++)
+            batch->transforms[i][k] = k < 3 ? 1.0f : 0.0f;
+        t3d_mat4fp_identity(&batch->matrices[i]);
+        if (usecolors)
+            batch->colors[i] = RGBA32(0xFF, 0xFF, 0xFF, 0xFF);
+        batch->visible[i] = true;
+        batch->groups[i] = 0;
+    }
+    batch->block = NULL;
+}
+
+
+/*==============================
+    instancing_set_transform
+    Sets the transform of an instance, the matrix is only
+    rebuilt if the transform has changed.
+    @param  The batch
+    @param  The instance
+    @param  The scale
+    @param  The rotation (euler angles, in radians)
+    @param  The position
+    @return True if the matrix was updated
+==============================*/
+
+bool instancing_set_transform(InstanceBatch* batch, uint32_t index, const float scale[3], const float rot[3], const float pos[3])
+{
+    float* last = batch->transforms[index];
+    if (last[0] == scale[0] && last[1] == scale[1] && last[2] == scale[2] &&
+        last[3] == rot[0]   && last[4] == rot[1]   && last[5] == rot[2]   &&
+        last[6] == pos[0]   && last[7] == pos[1]   && last[8] == pos[2])
+        return false;
+
+    for (int k=0; k<3; k++)
+    {
+        last[k]   = scale[k];
+        last[k+3] = rot[k];
+        last[k+6] = pos[k];
+    }
+    t3d_mat4fp_from_srt_euler(&batch->matrices[index], scale, rot, pos);
+    return true;
+}
+
+
+/*==============================
+    instancing_set_color
+    Sets the prim color of an instance
+    @param  The batch
+    @param  The instance
+    @param  The color
+==============================*/
+
+void instancing_set_color(InstanceBatch* batch, uint32_t index, color_t color)
+{
+    if (batch->colors != NULL)
+        batch->colors[index] = color;
+}
+
+
+/*==============================
+    instancing_set_visible
+    Shows or hides an instance
+    @param  The batch
+    @param  The instance
+    @param  Whether the instance should be drawn
+==============================*/
+
+void instancing_set_visible(InstanceBatch* batch, uint32_t index, bool visible)
+{
+    batch->visible[index] = visible;
+}
+
+
+/*==============================
+    instancing_set_group
+    Assigns an instance to a group
+    @param  The batch
+    @param  The instance
+    @param  The group
+==============================*/
+
+void instancing_set_group(InstanceBatch* batch, uint32_t index, uint8_t group)
+{
+    batch->groups[index] = group;
+}
+
+
+/*==============================
+    instancing_draw_filtered
+    Draws the visible instances, optionally only the ones
+    of a single group
+    @param  The batch
+    @param  The model state, can be NULL
+    @param  The group to draw, or -1 for all
+    @param  The material override, or NULL
+==============================*/
+
+static void instancing_draw_filtered(InstanceBatch* batch, T3DModelState* state, int group, T3DMaterial* material)
+{
+    bool hasinstances = false;
+    for (uint32_t i=0; i<batch->count && !hasinstances; i++)
+        hasinstances = batch->visible[i] && (group < 0 || batch->groups[i] == group);
+    if (!hasinstances)
+        return;
+
+    for (uint32_t o=0; o<batch->objectcount; o++)
+    {
+        if (material == NULL || o == 0)
+            t3d_model_draw_material(material != NULL ? material : batch->objects[o]->material, state);
+
+        for (uint32_t i=0; i<batch->count; i++)
+        {
+            if (!batch->visible[i] || (group >= 0 && batch->groups[i] != group))
+                continue;
+
+            t3d_matrix_set(&batch->matrices[i], true);
+            if (batch->colors != NULL)
+                rdpq_set_prim_color(batch->colors[i]);
+            rspq_block_run(batch->objectblocks[o]);
+        }
+    }
+}
+
+
+/*==============================
+    instancing_draw
+    Draws all visible instances
+    @param  The batch
+    @param  The model state, can be NULL
+==============================*/
+
+void instancing_draw(InstanceBatch* batch, T3DModelState* state)
+{
+    if (batch->block != NULL)
+        rspq_block_run(batch->block);
+    else
+        instancing_draw_filtered(batch, state, -1, NULL);
+}
+
+
+/*==============================
+    instancing_draw_group
+    Draws all visible instances of one group
+    @param  The batch
+    @param  The model state, can be NULL
+    @param  The group to draw
+    @param  The material override, or NULL
+==============================*/
+
+void instancing_draw_group(InstanceBatch* batch, T3DModelState* state, uint8_t group, T3DMaterial* material)
+{
+    instancing_draw_filtered(batch, state, group, material);
+}
+
+
+/*==============================
+    instancing_record
+    Records the draw of all visible instances into one block
+    @param  The batch
+==============================*/
+
+void instancing_record(InstanceBatch* batch)
+{
+    if (batch->block != NULL)
+        rspq_block_free(batch->block);
+
+    rspq_block_begin();
+        instancing_draw_filtered(batch, NULL, -1, NULL);
+    batch->block = rspq_block_end();
+}
+
+
+/*==============================
+    instancing_free
+    Frees all the memory of a batch
+    @param  The batch to free
+==============================*/
+
+void instancing_free(InstanceBatch* batch)
+{
+    if (batch->block != NULL)
+        rspq_block_free(batch->block);
+    for (uint32_t i=0; i<batch->objectcount; i++)
+        rspq_block_free(batch->objectblocks[i]);
+
+    free(batch->objectblocks);
+    free(batch->objects);
+    free_uncached(batch->matrices);
+    free(batch->transforms);
+    free(batch->colors);
+    free(batch->visible);
+    free(batch->groups);
+    batch->block = NULL;
+    batch->count = 0;
+    batch->objectcount = 0;
+}
+
+
+/*==============================
+    instancing_benchmark
+    Compares one recorded block per instance against a
+    batch, and prints the timings
+    @param  The model to draw
+    @param  The number of instances
+==============================*/
+
+void instancing_benchmark(T3DModel* model, uint32_t count)
+{
+    InstanceBatch batch;
+    rspq_block_t** blocks = malloc(sizeof(rspq_block_t*) * count);
+    color_t color = RGBA32(0xFF, 0xFF, 0xFF, 0xFF);
+
+    instancing_init(&batch, model, NULL, count, true);
+    for (uint32_t i=0; i<count; i++)
+    {
+        float pos[3] = {(float)(i % 16) * 10.0f, 0.0f, (float)(i / 16) * 10.0f};
+        instancing_set_transform(&batch, i, (float[3]){0.1f, 0.1f, 0.1f}, (float[3]){0, 0, 0}, pos);
+
+        // The pattern this replaces: a full model draw recorded per instance
+        rspq_block_begin();
+            t3d_matrix_push(&batch.matrices[i]);
+            rdpq_set_prim_color(color);
+            t3d_model_draw(model);
+            t3d_matrix_pop(1);
+        blocks[i] = rspq_block_end();
+    }
+    rspq_wait();
+
+    uint32_t start = get_ticks();
+    for (uint32_t i=0; i<count; i++)
+        rspq_block_run(blocks[i]);
+    uint32_t blockcpu = get_ticks() - start;
+    rspq_wait();
+    uint32_t blocktotal = get_ticks() - start;
+
+    t3d_matrix_push_pos(1);
+    start = get_ticks();
+    instancing_draw(&batch, NULL);
+    uint32_t batchcpu = get_ticks() - start;
+    rspq_wait();
+    uint32_t batchtotal = get_ticks() - start;
+
+    instancing_record(&batch);
+    rspq_wait();
+    start = get_ticks();
+    instancing_draw(&batch, NULL);
+    uint32_t recordedcpu = get_ticks() - start;
+    rspq_wait();
+    uint32_t recordedtotal = get_ticks() - start;
+    t3d_matrix_pop(1);
+
+    debugf("instancing: %lu instances, %lu objects\n", (unsigned long)count, (unsigned long)batch.objectcount);
+    debugf("  per-instance blocks: cpu %luus, total %luus\n", (unsigned long)TICKS_TO_US(blockcpu), (unsigned long)TICKS_TO_US(blocktotal));
+    debugf("  batch:               cpu %luus, total %luus\n", (unsigned long)TICKS_TO_US(batchcpu), (unsigned long)TICKS_TO_US(batchtotal));
+    debugf("  recorded batch:      cpu %luus, total %luus\n", (unsigned long)TICKS_TO_US(recordedcpu), (unsigned long)TICKS_TO_US(recordedtotal));
+
+    for (uint32_t i=0; i<count; i++)
+        rspq_block_free(blocks[i]);
+    free(blocks);
+    instancing_free(&batch);
+}
@@ -0,0 +1,150 @@
+#ifndef GAMEJAM2024_INSTANCING_H
+#define GAMEJAM2024_INSTANCING_H
+
+#include <libdragon.h>
+#include <t3d/t3d.h>
+#include <t3d/t3dmodel.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    /***************************************************************
+                     Public Instancing Structures
+    ***************************************************************/
+
+    // Many copies of one static (non-skinned) mesh.
+    // The mesh is recorded once without its material, drawing the
+    // batch sets each material once and then only emits a matrix,
+    // an optional color and a block call for every visible instance.
+    typedef struct {
+        uint32_t count;
+        uint32_t objectcount;
+        T3DObject** objects;
+        rspq_block_t** objectblocks;
+        T3DMat4FP* matrices;     // Uncached, read by the RSP
+        float (*transforms)[9];  // Last scale/rotation/position, to skip unchanged instances
+        color_t* colors;         // NULL if the batch has no per-instance color
+        uint8_t* visible;
+        uint8_t* groups;
+        rspq_block_t* block;     // Set by instancing_record
+    } InstanceBatch;
+
+
+    /***************************************************************
+                      Public Instancing Functions
+    ***************************************************************/
+
+    /*==============================
+        instancing_init
+        Creates a batch of instances of a model.
+        All instances start visible, in group 0, with
+        an identity transform.
+        @param  The batch to initialize
+        @param  The model to instance
+        @param  The object to draw, or NULL for all objects
+                of the model
+        @param  The number of instances
+        @param  Whether every instance sets its own prim color
+    ==============================*/
+    void instancing_init(InstanceBatch* batch, T3DModel* model, T3DObject* object, uint32_t count, bool usecolors);
+
+    /*==============================
+        instancing_set_transform
+        Sets the transform of an instance. The matrix is only
+        rebuilt and uploaded if the transform has changed.
+        @param  The batch
+        @param  The instance
+        @param  The scale
+        @param  The rotation (euler angles, in radians)
+        @param  The position
+        @return True if the matrix was updated
+    ==============================*/
+    bool instancing_set_transform(InstanceBatch* batch, uint32_t index, const float scale[3], const float rot[3], const float pos[3]);
+
+    /*==============================
+        instancing_set_color
+        Sets the prim color of an instance. Only used if the
+        batch was created with colors.
+        @param  The batch
+        @param  The instance
+        @param  The color
+    ==============================*/
+    void instancing_set_color(InstanceBatch* batch, uint32_t index, color_t color);
+
+    /*==============================
+        instancing_set_visible
+        Shows or hides an instance
+        @param  The batch
+        @param  The instance
+        @param  Whether the instance should be drawn
+    ==============================*/
+    void instancing_set_visible(InstanceBatch* batch, uint32_t index, bool visible);
+
+    /*==============================
+        instancing_set_group
+        Assigns an instance to a group, so it can be drawn
+        separately with instancing_draw_group
+        @param  The batch
+        @param  The instance
+        @param  The group
+    ==============================*/
+    void instancing_set_group(InstanceBatch* batch, uint32_t index, uint8_t group);
+
+    /*==============================
+        instancing_draw
+        Draws all visible instances. Must be called while
+        a viewport is attached. Each instance sets its matrix
+        into the current slot of the matrix stack, so one has
+        to be pushed first (e.g. with t3d_matrix_push_pos).
+        @param  The batch
+        @param  The model state to skip redundant material
+                changes, can be NULL
+    ==============================*/
+    void instancing_draw(InstanceBatch* batch, T3DModelState* state);
+
+    /*==============================
+        instancing_draw_group
+        Draws all visible instances of one group
+        @param  The batch
+        @param  The model state, can be NULL
+        @param  The group to draw
+        @param  The material to use instead of the ones
+                of the objects, or NULL
+    ==============================*/
+    void instancing_draw_group(InstanceBatch* batch, T3DModelState* state, uint8_t group, T3DMaterial* material);
+
+    /*==============================
+        instancing_record
+        Records the draw of all visible instances into one
+        block, which instancing_draw then runs instead.
+        Matrices can still be changed afterwards, but
+        changes to the visibility or colors are ignored.
+        @param  The batch
+    ==============================*/
+    void instancing_record(InstanceBatch* batch);
+
+    /*==============================
+        instancing_free
+        Frees all the memory of a batch. The model itself
+        is not freed.
+        @param  The batch to free
+    ==============================*/
+    void instancing_free(InstanceBatch* batch);
+
+    /*==============================
+        instancing_benchmark
+        Draws a model with one recorded block per instance,
+        and then as a batch, and prints the CPU time to
+        submit each and the time until the RSP/RDP finished.
+        Must be called while a frame is being drawn.
+        @param  The model to draw
+        @param  The number of instances
+    ==============================*/
+    void instancing_benchmark(T3DModel* model, uint32_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -8,6 +8,7 @@ This file contains the code for the basic menu
 #include <string.h>
 #include "menu.h"
 #include "core.h"
+#include "assetcache.h"
 #include "minigame.h"
 #include "config.h"
 #include "results.h"
@@ -71,7 +72,7 @@ static rdpq_font_t *fontdbg;
 static int* sorted_indices;
 
 static wav64_t sfx_cursor;
-static wav64_t sfx_confirm;
+static wav64_t* sfx_confirm;
 static wav64_t sfx_back;
 static wav64_t sfx_drumroll;
 static wav64_t sfx_crash;
@@ -217,7 +218,7 @@ void menu_init()
     slider = sprite_load("rom:/slider.ia4.sprite");
     spr_a = sprite_load("rom:/core/AButton.sprite");
 
-    font = rdpq_font_load("rom:/squarewave.font64");
+    font = assetcache_get_font(ASSETCACHE_FONT_SQUAREWAVE);
     rdpq_text_register_font(FONT_TEXT, font);
     rdpq_font_style(font, 0, &(rdpq_fontstyle_t){.color = TEXT_COLOR, .outline_color = GUN_METAL });
     rdpq_font_style(font, 1, &(rdpq_fontstyle_t){.color = ASH_GRAY,  .outline_color = GUN_METAL });
@@ -228,7 +229,7 @@ void menu_init()
     rdpq_text_register_font(FONT_DEBUG, fontdbg);
 
     wav64_open(&sfx_cursor, "rom:/core/cursor.wav64");
-    wav64_open(&sfx_confirm, "rom:/core/menu_confirm.wav64");
+    sfx_confirm = assetcache_get_sound("rom:/core/menu_confirm.wav64");
     wav64_open(&sfx_back, "rom:/core/menu_back.wav64");
     wav64_open(&sfx_drumroll, "rom:/core/DrumRoll.wav64");
     wav64_open(&sfx_crash, "rom:/core/Crash.wav64");
@@ -333,7 +334,7 @@ void menu_loop(float deltatime)
                 }
                 else if (!ai_selected)
                 {
-                    wav64_play(&sfx_confirm, 30);
+                    wav64_play(sfx_confirm, 30);
                     ai_selected = true;
                 }
             }
@@ -374,7 +375,7 @@ void menu_loop(float deltatime)
         if (a_pressed) {
             menu_done = true;
             fadeouttime = FADETIME;
-            wav64_play(&sfx_confirm, 30);
+            wav64_play(sfx_confirm, 30);
         } else if (b_pressed && core_get_nextround() == NR_FREEPLAY) {
             menu_done = true;
             menu_quit = true;
@@ -625,11 +626,11 @@ void menu_cleanup()
 
     rdpq_text_unregister_font(FONT_TEXT);
     rdpq_text_unregister_font(FONT_DEBUG);
-    rdpq_font_free(font);
+    assetcache_release_font(font);
     rdpq_font_free(fontdbg);
 
     wav64_close(&sfx_cursor);
-    wav64_close(&sfx_confirm);
+    assetcache_release_sound(sfx_confirm);
     wav64_close(&sfx_back);
     wav64_close(&sfx_drumroll);
     wav64_close(&sfx_crash);
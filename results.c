@@ -6,6 +6,7 @@ The file contains the results screen
 
 #include "results.h"
 #include "core.h"
+#include "assetcache.h"
 #include "menu.h"
 #include "savestate.h"
 #include <libdragon.h>
@@ -46,7 +47,7 @@ static sprite_t *icon_playerselected;
 static sprite_t *icon_star;
 
 static wav64_t sfx_point;
-static wav64_t sfx_confirm;
+static wav64_t* sfx_confirm;
 static wav64_t sfx_winner;
 static wav64_t sfx_roulette1;
 static wav64_t sfx_roulette2;
@@ -172,7 +173,7 @@ void results_init()
         core_set_curchooser(rand() % MAXPLAYERS);
     }
 
-    font = rdpq_font_load("rom:/squarewave.font64");
+    font = assetcache_get_font(ASSETCACHE_FONT_SQUAREWAVE);
     rdpq_text_register_font(FONT_TEXT, font);
     rdpq_font_style(font, FONT_STYLE_DEFAULT, &(rdpq_fontstyle_t){.color = RGBA32(0xFF,0xDD,0xDD,0xFF), .outline_color = RGBA32(0x31,0x39,0x3C,0xFF) });
     rdpq_font_style(font, FONT_STYLE_WHITE, &(rdpq_fontstyle_t){.color = RGBA32(0xFF,0xFF,0xFF,0xFF) });
@@ -193,7 +194,7 @@ void results_init()
     icon_star = sprite_load("rom:/iconStar.ia8.sprite");
 
     wav64_open(&sfx_point, "rom:/core/Point.wav64");
-    wav64_open(&sfx_confirm, "rom:/core/menu_confirm.wav64");
+    sfx_confirm = assetcache_get_sound("rom:/core/menu_confirm.wav64");
     wav64_open(&sfx_winner, "rom:/core/ResultsWinner.wav64");
     wav64_open(&sfx_roulette1, "rom:/core/RoulettePlayer.wav64");
     wav64_open(&sfx_roulette2, "rom:/core/RouletteDone.wav64");
@@ -561,7 +562,7 @@ void results_loop(float deltatime)
 
     bool confirm_pressed = btn[0].a || btn[1].a || btn[2].a || btn[3].a;
     if (can_confirm && !fading_out && confirm_pressed) {
-        wav64_play(&sfx_confirm, 31);
+        wav64_play(sfx_confirm, 31);
         if (core_get_nextround() == NR_RANDOMGAME) {
             fading_out = true;
             fade_out_start = time;
@@ -584,7 +585,7 @@ void results_cleanup()
 {
     rspq_wait();
     rdpq_text_unregister_font(FONT_TEXT);
-    rdpq_font_free(font);
+    assetcache_release_font(font);
     sprite_free(bg_pattern);
     sprite_free(bg_gradient);
     sprite_free(btn_game);
@@ -592,7 +593,7 @@ void results_cleanup()
     sprite_free(icon_playerselected);
     sprite_free(icon_star);
     wav64_close(&sfx_point);
-    wav64_close(&sfx_confirm);
+    assetcache_release_sound(sfx_confirm);
     wav64_close(&sfx_winner);
     wav64_close(&sfx_roulette1);
     wav64_close(&sfx_roulette2);
@@ -0,0 +1,118 @@
+/***************************************************************
+                          savejournal.c
+
+Keeps a save in two EEPROM slots, so that a write which is cut
+off leaves the previous save intact
+***************************************************************/
+
+#include <string.h>
+#include "savejournal.h"
+
+
+/*==============================
+    slot_get16
+    Read a 16-bit field of a slot
+    @param  The slot contents
+    @param  The offset of the field
+    @return The field's value
+==============================*/
+
+static uint16_t slot_get16(const uint8_t* slot, int offset)
+{
+    uint16_t value;
+    memcpy(&value, &slot[offset], sizeof(value));
+    return value;
+}
+
+
+/*==============================
+    slot_set16
+    Write a 16-bit field of a slot
+    @param  The slot contents
+    @param  The offset of the field
+    @param  The value to write
+==============================*/
+
+static void slot_set16(uint8_t* slot, int offset, uint16_t value)
+{
+    memcpy(&slot[offset], &value, sizeof(value));
+}
+
+
+/*==============================
+    savejournal_crc
+    Calculate the CRC-16-CCITT of a slot, which covers
+    everything but the CRC itself
+    @param  The slot contents
+    @param  The size of the slot
+    @return The CRC
+==============================*/
+
+uint16_t savejournal_crc(const uint8_t* slot, int slotsize)
+{
+    uint16_t crc = 0xFFFF;
+    for (int i=0; i<slotsize-2; i++)
+    {
+        crc ^= slot[i] << 8;
+        for (int j=0; j<8; j++)
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+    return crc;
+}
+
+
+/*==============================
+    savejournal_load
+    Pick the valid slot with the newest save, after the
+    slots have been read from EEPROM into journal->slots
+    @param  The save journal
+    @return The picked slot, or -1 if none is valid
+==============================*/
+
+int savejournal_load(SaveJournal* journal)
+{
+    int size = journal->slotsize;
+    int picked = -1;
+
+    for (int i=0; i<SAVEJOURNAL_SLOTCOUNT; i++)
+    {
+        const uint8_t* slot = &journal->slots[i*size];
+        if (slot_get16(slot, size-2) != savejournal_crc(slot, size))
+            continue;
+        if (picked == -1 || (int16_t)(slot_get16(slot, size-4) - slot_get16(&journal->slots[picked*size], size-4)) > 0)
+            picked = i;
+    }
+
+    // With no valid slot, the first write goes to slot 0
+    journal->curslot = (picked == -1) ? SAVEJOURNAL_SLOTCOUNT-1 : picked;
+    return picked;
+}
+
+
+/*==============================
+    savejournal_write
+    Write a save to the slot which doesn't hold the latest
+    one. Only the blocks which differ from what's in that
+    slot are written. The sequence and CRC are filled in.
+    @param  The save journal
+    @param  The save to write, slotsize bytes
+==============================*/
+
+void savejournal_write(SaveJournal* journal, uint8_t* data)
+{
+    int size = journal->slotsize;
+    int slot = (journal->curslot + 1) % SAVEJOURNAL_SLOTCOUNT;
+    int blocks = size/SAVEJOURNAL_BLOCKSIZE;
+    uint8_t* olddata = &journal->slots[slot*size];
+
+    slot_set16(data, size-4, slot_get16(data, size-4) + 1);
+    slot_set16(data, size-2, savejournal_crc(data, size));
+
+    // The last block always changes, as it holds the sequence and CRC
+    for (int i=0; i<blocks; i++)
+        if (memcmp(&data[i*SAVEJOURNAL_BLOCKSIZE], &olddata[i*SAVEJOURNAL_BLOCKSIZE], SAVEJOURNAL_BLOCKSIZE) != 0)
+            journal->write(slot*blocks + i, &data[i*SAVEJOURNAL_BLOCKSIZE]);
+
+    memcpy(olddata, data, size);
+    journal->curslot = slot;
+}
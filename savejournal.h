@@ -0,0 +1,69 @@
+#ifndef GAMEJAM2024_SAVEJOURNAL_H
+#define GAMEJAM2024_SAVEJOURNAL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+    /***************************************************************
+                      Public Save Journal Constants
+    ***************************************************************/
+
+    // EEPROM is written in blocks of this many bytes
+    #define SAVEJOURNAL_BLOCKSIZE  8
+
+    // The save is kept in this many slots, which are written to in turns
+    #define SAVEJOURNAL_SLOTCOUNT  2
+
+
+    /***************************************************************
+                       Public Save Journal Types
+    ***************************************************************/
+
+    // Writes one block of EEPROM, like libdragon's eeprom_write
+    typedef void (*SaveJournalWrite)(int block, const uint8_t* data);
+
+    // A slot is slotsize bytes, a multiple of SAVEJOURNAL_BLOCKSIZE.
+    // Its last 4 bytes are the sequence and the CRC, so they share
+    // the last block, which is always written last.
+    typedef struct {
+        uint8_t* slots;         // What each slot in EEPROM currently holds, one after the other
+        int slotsize;
+        int curslot;            // The slot with the latest save
+        SaveJournalWrite write;
+    } SaveJournal;
+
+
+    /***************************************************************
+                     Public Save Journal Functions
+    ***************************************************************/
+
+    /*==============================
+        savejournal_crc
+        Calculate the CRC-16-CCITT of a slot, which covers
+        everything but the CRC itself
+        @param  The slot contents
+        @param  The size of the slot
+        @return The CRC
+    ==============================*/
+    extern uint16_t savejournal_crc(const uint8_t* slot, int slotsize);
+
+    /*==============================
+        savejournal_load
+        Pick the valid slot with the newest save, after the
+        slots have been read from EEPROM into journal->slots
+        @param  The save journal
+        @return The picked slot, or -1 if none is valid
+    ==============================*/
+    extern int savejournal_load(SaveJournal* journal);
+
+    /*==============================
+        savejournal_write
+        Write a save to the slot which doesn't hold the latest
+        one. Only the blocks which differ from what's in that
+        slot are written. The sequence and CRC are filled in.
+        @param  The save journal
+        @param  The save to write, slotsize bytes
+    ==============================*/
+    extern void savejournal_write(SaveJournal* journal, uint8_t* data);
+
+#endif
@@ -10,12 +10,14 @@ loaded if it crashes
 #include "minigame.h"
 #include "results.h"
 #include "savestate.h"
+#include "savejournal.h"
 
 
 /*********************************
             Structures
 *********************************/
 
+// Kept in two slots by savejournal.c, which owns the sequence and CRC
 typedef struct {
     char header[4];
     uint32_t blacklist;
@@ -27,9 +29,14 @@ typedef struct {
     uint8_t points[MAXPLAYERS];
     uint8_t chooser;
     uint8_t curgame;
-    uint8_t checksum;
+    uint8_t reserved[6];
+    uint16_t sequence;
+    uint16_t crc;
 } GameSave;
 
+_Static_assert(sizeof(GameSave) % SAVEJOURNAL_BLOCKSIZE == 0, "GameSave must fill whole EEPROM blocks");
+_Static_assert(offsetof(GameSave, sequence) == sizeof(GameSave)-4 && offsetof(GameSave, crc) == sizeof(GameSave)-2, "The sequence and CRC must end GameSave");
+
 
 /*********************************
        Function Prototypes
@@ -38,6 +45,7 @@ typedef struct {
 static bool controller_isleft();
 static bool controller_isright();
 static bool controller_isa();
+static void savestate_writeblock(int block, const uint8_t* data);
 
 
 /*********************************
@@ -47,23 +55,21 @@ static bool controller_isa();
 static int global_selection;
 static uint8_t global_cansave;
 static GameSave global_gamesave;
+static GameSave global_saveslots[SAVEJOURNAL_SLOTCOUNT];
+static SaveJournal global_journal = {(uint8_t*)global_saveslots, sizeof(GameSave), 0, savestate_writeblock};
 static rdpq_font_t* global_font;
 
 
 /*==============================
-    calc_checksum
-    Calculate a basic checksum for the save state
-    This is done by just adding all the bytes together
-    @return The checksum
+    savestate_writeblock
+    Write one block of a save slot to EEPROM
+    @param  The EEPROM block to write
+    @param  The 8 bytes to write
 ==============================*/
 
-static uint8_t calc_checksum()
+static void savestate_writeblock(int block, const uint8_t* data)
 {
-    uint8_t checksum = 0;
-    uint8_t* asarray = (uint8_t*)&global_gamesave;
-    for (int i=0; i<sizeof(GameSave); i++)
-        checksum += asarray[i];
-    return checksum;
+    eeprom_write(block, data);
 }
 
 
@@ -82,19 +88,23 @@ bool savestate_initialize()
         return false;
     global_cansave = 1;
         
-    // Read the savestate from EEPROM
-    eeprom_read_bytes((uint8_t*)(&global_gamesave), 0, sizeof(GameSave));
-   
+    // Read both save slots from EEPROM
+    eeprom_read_bytes((uint8_t*)global_saveslots, 0, sizeof(global_saveslots));
+
+    // Use the valid slot with the newest save
+    int slot = savejournal_load(&global_journal);
+
     // If the EEPROM hasn't been initialized before, do so now
-    if (strncmp(global_gamesave.header, "NBGJ", 4) != 0)
+    if (slot == -1 || strncmp(global_saveslots[slot].header, "NBGJ", 4) != 0)
     {
         memset(&global_gamesave, 0, sizeof(GameSave));
         global_gamesave.header[0] = 'N';
         global_gamesave.header[1] = 'B';
         global_gamesave.header[2] = 'G';
         global_gamesave.header[3] = 'J';
-        global_gamesave.checksum = calc_checksum();
     }
+    else
+        global_gamesave = global_saveslots[slot];
     
     // Success
     return true;
@@ -139,11 +149,10 @@ void savestate_save(bool configonly)
         global_gamesave.nextplaystyle = core_get_nextround();
         global_gamesave.chooser = core_get_curchooser();
         global_gamesave.curgame = minigame_get_index();
-        global_gamesave.checksum = calc_checksum();
     }
     
     // Save to EEPROM
-    eeprom_write_bytes((uint8_t*)(&global_gamesave), 0, sizeof(GameSave));
+    savejournal_write(&global_journal, (uint8_t*)&global_gamesave);
 }
 
 
@@ -185,7 +194,7 @@ void savestate_clear()
     if (!global_cansave)
         return;
     global_gamesave.crashedflag = 0;
-    eeprom_write_bytes((uint8_t*)(&global_gamesave), 0, sizeof(GameSave));
+    savejournal_write(&global_journal, (uint8_t*)&global_gamesave);
 }
 
 void savestate_setblacklist(bool* list)
@@ -0,0 +1,405 @@
+/***************************************************************
+                     avanto_script_test.c
+
+Host test for the avanto script engine. Runs the first sauna
+walk-in script and the lake intro scripts frame by frame, with
+stubbed tiny3d animations and sounds, and checks positions,
+rotations and the camera against fixed expected values.
+Run with "make -C tests".
+***************************************************************/
+
+#include <stdio.h>
+#include <libdragon.h>
+#include <t3d/t3d.h>
+#include "../code/avanto/common.h"
+
+#define FRAME_TIME  (1.f/60.f)
+#define MAX_FRAMES  (60*60)
+#define TOLERANCE   0.01f
+
+// Animation lengths, the real ones come from the models
+#define WALK_LENGTH   1.f
+#define CLIMB_LENGTH  1.5f
+#define SIT_LENGTH    2.f
+
+// From sauna.c
+#define DOOR_CHANNEL 11
+#define SAUNA_WALK_SPEED 100.f
+
+// From lake.c
+#define FOCUS_Y 36.f
+#define FOCUS_X (PLAYER_MIN_X+1.5f*PLAYER_DISTANCE)
+#define CAMERA_X -500.f
+#define CAMERA_Y 380.f
+#define PLAYER_MIN_X -125.f
+#define PLAYER_DISTANCE 60.f
+#define PLAYER_STARTING_Z -490.f
+#define RACE_START_Z 1050.f
+#define RACE_END_Z (80.f*64.f)
+#define LAKE_WALK_SPEED 200.f
+
+
+/*********************************
+             Globals
+*********************************/
+
+T3DViewport viewport;
+struct camera cam;
+
+static int global_failures;
+static int global_sfx_plays;
+static int global_sfx_channel;
+static int global_xm64_plays;
+static int global_callbacks;
+static T3DChunkAnim global_anim_refs[NUM_PLAYER_ANIMS];
+static T3DAnim global_anims[NUM_PLAYER_ANIMS];
+
+
+/*********************************
+             Scripts
+*********************************/
+
+// The first player's walk-in script from sauna.c, the stubs only count
+// the sounds so they are left out
+static const struct script_action global_walk_in[] = {
+    {.type = ACTION_PLAY_SFX, .sfx = NULL, .channel = DOOR_CHANNEL},
+    {.type = ACTION_WAIT, .time = 2.f},
+    {.type = ACTION_START_XM64, .xm64 = NULL, .first_channel = 0},
+    {.type = ACTION_WARP_TO, .pos = (T3DVec3) {{-100, 0, 110}}},
+    {.type = ACTION_SET_VISIBILITY, .visibility = true},
+    {
+      .type = ACTION_WALK_TO,
+      .pos = (T3DVec3) {{100, 0, 110}},
+      .walk_speed = SAUNA_WALK_SPEED
+    },
+    {.type = ACTION_ROTATE_TO, .rot = 0.f, .speed = T3D_PI},
+    {.type = ACTION_CLIMB_TO, .pos = (T3DVec3) {{100, 0, 200}}},
+    {.type = ACTION_START_ANIM, .anim = WALK},
+    {.type = ACTION_ROTATE_TO, .rot = T3D_DEG_TO_RAD(-90.f), .speed = -T3D_PI},
+    {
+      .type = ACTION_WALK_TO,
+      .pos = (T3DVec3) {{300, 0, 210}},
+      .walk_speed = SAUNA_WALK_SPEED
+    },
+    {.type = ACTION_ROTATE_TO, .rot = T3D_DEG_TO_RAD(180.f), .speed = -T3D_PI},
+    {.type = ACTION_DO_WHOLE_ANIM, .anim = SIT},
+    {.type = ACTION_END},
+};
+
+static void count_callback()
+{
+    global_callbacks++;
+}
+
+// The camera and first player's intro scripts from lake.c
+static const struct script_action global_lake_camera[] = {
+    {
+      .type = ACTION_MOVE_CAMERA_TO,
+      .pos = (T3DVec3) {{FOCUS_X-200.f, FOCUS_Y*1.5f, RACE_END_Z + 5.f*64.f}},
+      .target = (T3DVec3) {{FOCUS_X, FOCUS_Y*1.5f, RACE_END_Z + 5.f*64.f}},
+      .travel_time = 0.f,
+    },
+    {.type = ACTION_WAIT, .time = 2.f},
+    {
+      .type = ACTION_MOVE_CAMERA_TO,
+      .pos = (T3DVec3) {{FOCUS_X-200.f, FOCUS_Y*1.5f, RACE_END_Z+4.5f*64.f}},
+      .target = (T3DVec3) {{FOCUS_X, FOCUS_Y*1.5f, RACE_END_Z}},
+      .travel_time = 1.f,
+    },
+    {
+      .type = ACTION_MOVE_CAMERA_TO,
+      .pos = (T3DVec3) {{FOCUS_X-200, FOCUS_Y*1.5f, PLAYER_STARTING_Z+200}},
+      .target = (T3DVec3) {{FOCUS_X, FOCUS_Y*1.5f, PLAYER_STARTING_Z}},
+      .travel_time = 5.f,
+    },
+    {.type = ACTION_SEND_SIGNAL, .signal = 0},
+    {
+      .type = ACTION_MOVE_CAMERA_TO,
+      .pos = (T3DVec3) {{FOCUS_X-200, FOCUS_Y*1.5f, RACE_START_Z+200}},
+      .target = (T3DVec3) {{FOCUS_X, FOCUS_Y*1.5f, RACE_START_Z}},
+      .travel_time = (RACE_START_Z-PLAYER_STARTING_Z)/LAKE_WALK_SPEED,
+    },
+    {.type = ACTION_CALLBACK, .callback = count_callback},
+    {
+      .type = ACTION_MOVE_CAMERA_TO,
+      .pos = (T3DVec3) {{CAMERA_X, CAMERA_Y, RACE_START_Z}},
+      .target = (T3DVec3) {{FOCUS_X, FOCUS_Y, RACE_START_Z}},
+      .travel_time = 2.f,
+    },
+    {.type = ACTION_END},
+};
+
+static const struct script_action global_lake_player[] = {
+    {.type = ACTION_WAIT_FOR_SIGNAL, .signal = 0},
+    {
+      .type = ACTION_WALK_TO,
+      .pos = (T3DVec3) {{PLAYER_MIN_X, 0, RACE_START_Z}},
+      .walk_speed = LAKE_WALK_SPEED,
+    },
+    {.type = ACTION_START_ANIM, .anim = SWIM},
+    {.type = ACTION_ANIM_UPDATE_TO_TS, .time = 0.f},
+    {.type = ACTION_ANIM_SET_PLAYING, .playing = true},
+    {.type = ACTION_END},
+};
+
+
+/*********************************
+              Stubs
+*********************************/
+
+void wav64_play(wav64_t* wav, int ch)
+{
+    global_sfx_plays++;
+    global_sfx_channel = ch;
+}
+
+void xm64player_play(xm64player_t* player, int first_ch)
+{
+    global_xm64_plays++;
+}
+
+void t3d_anim_attach(T3DAnim* anim, const T3DSkeleton* skeleton)
+{
+    anim->skeleton = skeleton;
+    anim->time = 0.f;
+}
+
+void t3d_anim_set_playing(T3DAnim* anim, bool playing)
+{
+    anim->isPlaying = playing;
+}
+
+void t3d_anim_update(T3DAnim* anim, float delta_time)
+{
+    anim->time = delta_time;
+}
+
+void t3d_viewport_look_at(T3DViewport* viewport, const T3DVec3* eye, const T3DVec3* target, const T3DVec3* up)
+{
+    viewport->camPos = *eye;
+    viewport->camTarget = *target;
+}
+
+
+/*==============================
+    check_float
+    Compares a value with the expected one
+    @param  What is checked, for the report
+    @param  The value
+    @param  The expected value
+==============================*/
+
+static void check_float(const char* what, float value, float expected)
+{
+    if (fabsf(value - expected) > TOLERANCE)
+    {
+        printf("%s is %f, expected %f\n", what, value, expected);
+        global_failures++;
+    }
+}
+
+
+/*==============================
+    check_vec3
+    Compares a vector with the expected one
+    @param  What is checked, for the report
+    @param  The vector
+    @param  The expected x
+    @param  The expected y
+    @param  The expected z
+==============================*/
+
+static void check_vec3(const char* what, const T3DVec3* value, float x, float y, float z)
+{
+    if (fabsf(value->v[0] - x) > TOLERANCE || fabsf(value->v[1] - y) > TOLERANCE || fabsf(value->v[2] - z) > TOLERANCE)
+    {
+        printf("%s is (%f, %f, %f), expected (%f, %f, %f)\n", what,
+            value->v[0], value->v[1], value->v[2], x, y, z);
+        global_failures++;
+    }
+}
+
+
+/*==============================
+    check_frames
+    Compares a frame count with the expected one
+    @param  What is checked, for the report
+    @param  The frame count
+    @param  The expected frame count
+==============================*/
+
+static void check_frames(const char* what, int frames, int expected)
+{
+    if (frames != expected)
+    {
+        printf("%s took %d frames, expected %d\n", what, frames, expected);
+        global_failures++;
+    }
+}
+
+
+/*==============================
+    character_init
+    Sets up a character with the stubbed animations
+    @param  The character
+==============================*/
+
+static void character_init(struct character* c)
+{
+    memset(c, 0, sizeof(*c));
+    memset(global_anims, 0, sizeof(global_anims));
+    for (int i=0; i<NUM_PLAYER_ANIMS; i++)
+    {
+        global_anim_refs[i].duration = WALK_LENGTH;
+        global_anims[i].animRef = &global_anim_refs[i];
+    }
+    global_anim_refs[CLIMB].duration = CLIMB_LENGTH;
+    global_anim_refs[SIT].duration = SIT_LENGTH;
+    c->s.anims = global_anims;
+    c->s.num_anims = NUM_PLAYER_ANIMS;
+    c->current_anim = NUM_PLAYER_ANIMS;
+}
+
+
+/*==============================
+    test_sauna_walk_in
+    Runs the walk-in script, checking the walk halfway
+    through and where the player ends up
+==============================*/
+
+static void test_sauna_walk_in()
+{
+    struct character player;
+    struct script_state state;
+    int frames = 0;
+    bool done = false;
+
+    character_init(&player);
+    script_reset_signals();
+    state = (struct script_state){.character = &player, .action = global_walk_in, .time = 0.f};
+    global_sfx_plays = 0;
+    global_xm64_plays = 0;
+
+    while (frames < MAX_FRAMES && !done)
+    {
+        done = script_update(&state, FRAME_TIME);
+        frames++;
+
+        // The door opens straight away, the music only once the wait is over
+        if (frames == 1)
+        {
+            check_float("Sauna door sounds after one frame", global_sfx_plays, 1);
+            check_float("Sauna songs after one frame", global_xm64_plays, 0);
+        }
+
+        // One second into the first walk, with the leftover time of the wait handed over
+        if (frames == 180)
+        {
+            check_vec3("Sauna position after 3s", &player.pos, 0.f, 0.f, 110.f);
+            check_float("Sauna rotation after 3s", player.rotation, -T3D_PI/2.f);
+            check_float("Sauna animation after 3s", player.current_anim, WALK);
+        }
+    }
+
+    // 2 + 2 + 0.5 + 1.5 + 0.5 + 2.0025 + 0.5159 + 2 seconds
+    check_frames("Sauna walk-in", frames, 662);
+    check_vec3("Sauna end position", &player.pos, 300.f, 0.f, 210.f);
+    check_float("Sauna end rotation", player.rotation, T3D_PI);
+    check_float("Sauna end animation", player.current_anim, SIT);
+    check_float("Sauna visibility", player.visible, true);
+    check_float("Sauna door sounds", global_sfx_plays, 1);
+    check_float("Sauna door channel", global_sfx_channel, DOOR_CHANNEL);
+    check_float("Sauna songs", global_xm64_plays, 1);
+    if (global_anims[SIT].skeleton != &player.s.skeleton || !global_anims[SIT].isPlaying)
+    {
+        printf("Sauna sit animation isn't attached and playing\n");
+        global_failures++;
+    }
+}
+
+
+/*==============================
+    test_lake_intro
+    Runs the camera and player intro scripts together,
+    checking that the player waits for the camera's signal
+    and where the camera and player end up
+==============================*/
+
+static void test_lake_intro()
+{
+    struct character player;
+    struct script_state states[2];
+    int frames = 0;
+    bool done = false;
+
+    character_init(&player);
+    player.pos = (T3DVec3){{PLAYER_MIN_X, 0.f, PLAYER_STARTING_Z}};
+    script_reset_signals();
+    states[0] = (struct script_state){.character = NULL, .action = global_lake_camera, .time = 0.f};
+    states[1] = (struct script_state){.character = &player, .action = global_lake_player, .time = 0.f};
+    cam.pos = (T3DVec3){{CAMERA_X, CAMERA_Y, 0.f}};
+    cam.target = (T3DVec3){{FOCUS_X, FOCUS_Y, 0.f}};
+    global_callbacks = 0;
+
+    while (frames < MAX_FRAMES && !done)
+    {
+        done = script_update(&states[0], FRAME_TIME);
+        done = script_update(&states[1], FRAME_TIME) && done;
+        frames++;
+
+        // Halfway through the five second camera move, the player is still waiting
+        if (frames == 330)
+        {
+            float z = (RACE_END_Z+4.5f*64.f + PLAYER_STARTING_Z+200.f)/2.f;
+            check_vec3("Lake camera after 5.5s", &cam.pos, FOCUS_X-200.f, FOCUS_Y*1.5f, z);
+            // The camera turns from looking 4.5 tiles back to looking 200 back
+            check_vec3("Lake camera target after 5.5s", &cam.target, FOCUS_X, FOCUS_Y*1.5f, z - (4.5f*64.f + 200.f)/2.f);
+            check_vec3("Lake position after 5.5s", &player.pos, PLAYER_MIN_X, 0.f, PLAYER_STARTING_Z);
+        }
+
+        // Two seconds after the signal, the camera and player move together.
+        // The player wakes up on the frame the signal is sent, and walks that whole frame
+        if (frames == 600)
+        {
+            check_vec3("Lake camera after 10s", &cam.pos, FOCUS_X-200.f, FOCUS_Y*1.5f, PLAYER_STARTING_Z+200.f + 2.f*LAKE_WALK_SPEED);
+            check_vec3("Lake position after 10s", &player.pos, PLAYER_MIN_X, 0.f, PLAYER_STARTING_Z + (2.f + FRAME_TIME)*LAKE_WALK_SPEED);
+        }
+    }
+
+    // 2 + 1 + 5 + 7.7 + 2 seconds for the camera, the player is done after 15.7
+    check_frames("Lake intro", frames, 1062);
+    check_vec3("Lake end camera", &cam.pos, CAMERA_X, CAMERA_Y, RACE_START_Z);
+    check_vec3("Lake end camera target", &cam.target, FOCUS_X, FOCUS_Y, RACE_START_Z);
+    check_vec3("Lake viewport camera", &viewport.camPos, CAMERA_X, CAMERA_Y, RACE_START_Z);
+    check_vec3("Lake viewport target", &viewport.camTarget, FOCUS_X, FOCUS_Y, RACE_START_Z);
+    check_vec3("Lake end position", &player.pos, PLAYER_MIN_X, 0.f, RACE_START_Z);
+    check_float("Lake end rotation", player.rotation, 0.f);
+    check_float("Lake end animation", player.current_anim, SWIM);
+    check_float("Lake callbacks", global_callbacks, 1);
+    if (!global_anims[SWIM].isPlaying)
+    {
+        printf("Lake swim animation isn't playing\n");
+        global_failures++;
+    }
+}
+
+
+/*==============================
+    main
+    Runs the tests
+    @return 0 if every check passed
+==============================*/
+
+int main()
+{
+    test_sauna_walk_in();
+    test_lake_intro();
+
+    if (global_failures)
+    {
+        printf("%d avanto script checks failed\n", global_failures);
+        return 1;
+    }
+    printf("All avanto script checks passed\n");
+    return 0;
+}
@@ -0,0 +1,212 @@
+/***************************************************************
+                    landgrab_frontier_test.c
+
+Host test for the landgrab board bits. Plays random legal games
+with board_bits_blit and checks, after every placement, that
+each player's incremental frontier matches a full rescan with
+board_bits_frontier and a tile by tile scan of the board.
+Run with "make -C tests".
+***************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../code/landgrab/boardbits.h"
+
+#define GAMECOUNT  200
+
+
+/*********************************
+           Definitions
+*********************************/
+
+typedef struct {
+    const PieceMask* mask;
+    int piece;
+    int col;
+    int row;
+} Move;
+
+
+/*********************************
+             Globals
+*********************************/
+
+static int global_failures;
+static Move global_moves[PIECE_COUNT*PIECE_MAX_ORIENTATIONS*BOARD_SIZE];
+
+
+/*==============================
+    tile_owner
+    Finds who claimed a tile, looking at every player
+    @param  The board bits
+    @param  The column, may be off the board
+    @param  The row, may be off the board
+    @return The player, or -1 if unclaimed or off the board
+==============================*/
+
+static int tile_owner(const BoardBits* bits, int col, int row)
+{
+    if (col < 0 || col >= BOARD_COLS || row < 0 || row >= BOARD_ROWS)
+        return -1;
+    for (int p=0; p<BOARD_BITS_PLAYERS; p++)
+        if (bits->claimed[p][row + 1] & (1u << (col + 1)))
+            return p;
+    return -1;
+}
+
+
+/*==============================
+    frontier_by_tile
+    The frontier worked out one tile at a time, the way
+    the AI gathered its moves before the board bits
+    @param  The board bits
+    @param  The player
+    @param  The frontier, in padded rows
+==============================*/
+
+static void frontier_by_tile(const BoardBits* bits, int p, uint32_t frontier[BOARD_BITS_ROWS])
+{
+    memset(frontier, 0, sizeof(uint32_t)*BOARD_BITS_ROWS);
+    for (int row=0; row<BOARD_ROWS; row++)
+    {
+        for (int col=0; col<BOARD_COLS; col++)
+        {
+            if (tile_owner(bits, col, row) != -1)
+                continue;
+            if (tile_owner(bits, col-1, row) == p || tile_owner(bits, col+1, row) == p ||
+                tile_owner(bits, col, row-1) == p || tile_owner(bits, col, row+1) == p)
+                continue;
+            if (tile_owner(bits, col-1, row-1) == p || tile_owner(bits, col+1, row-1) == p ||
+                tile_owner(bits, col-1, row+1) == p || tile_owner(bits, col+1, row+1) == p)
+                frontier[row + 1] |= 1u << (col + 1);
+        }
+    }
+}
+
+
+/*==============================
+    check_frontiers
+    Compare every player's incremental frontier with both
+    full scans
+    @param  The board bits
+    @param  The game, for the report
+    @param  The placement, for the report
+==============================*/
+
+static void check_frontiers(const BoardBits* bits, int game, int placement)
+{
+    for (int p=0; p<BOARD_BITS_PLAYERS; p++)
+    {
+        uint32_t rescan[BOARD_BITS_ROWS];
+        uint32_t bytile[BOARD_BITS_ROWS];
+        board_bits_frontier(bits, p, rescan);
+        frontier_by_tile(bits, p, bytile);
+        if (memcmp(bits->frontier[p], rescan, sizeof(rescan)) != 0)
+        {
+            printf("Game %d, placement %d: P%d frontier differs from board_bits_frontier\n", game, placement, p + 1);
+            global_failures++;
+        }
+        if (memcmp(rescan, bytile, sizeof(rescan)) != 0)
+        {
+            printf("Game %d, placement %d: P%d board_bits_frontier differs from the tile scan\n", game, placement, p + 1);
+            global_failures++;
+        }
+    }
+}
+
+
+/*==============================
+    gather_moves
+    List every legal move of a player
+    @param  The board bits
+    @param  The player
+    @param  Whether it is the player's first turn
+    @param  Which pieces the player has used
+    @return The number of moves in global_moves
+==============================*/
+
+static int gather_moves(const BoardBits* bits, int p, bool first_turn, const bool* used)
+{
+    int count = 0;
+    for (int piece=0; piece<PIECE_COUNT; piece++)
+    {
+        if (used[piece])
+            continue;
+
+        const PieceOrientations* orientations = piece_get_orientations(piece);
+        for (size_t o=0; o<orientations->count; o++)
+        {
+            const PieceMask* mask = &orientations->masks[o];
+            for (int row=0; row<=BOARD_ROWS-mask->rows; row++)
+                for (int col=0; col<=BOARD_COLS-mask->cols; col++)
+                    if (board_bits_check(bits, p, first_turn, mask, col, row))
+                        global_moves[count++] = (Move){mask, piece, col, row};
+        }
+    }
+    return count;
+}
+
+
+/*==============================
+    play_game
+    Play one random game until nobody can move, checking
+    the frontiers after every placement
+    @param  The game number, also used as the seed
+    @return The number of placements
+==============================*/
+
+static int play_game(int game)
+{
+    BoardBits bits;
+    bool used[BOARD_BITS_PLAYERS][PIECE_COUNT];
+    bool first_turn[BOARD_BITS_PLAYERS];
+    int placements = 0;
+    int passes = 0;
+
+    memset(&bits, 0, sizeof(bits));
+    memset(used, 0, sizeof(used));
+    for (int p=0; p<BOARD_BITS_PLAYERS; p++)
+        first_turn[p] = true;
+    srand(game);
+
+    for (int p=0; passes<BOARD_BITS_PLAYERS; p=(p + 1)%BOARD_BITS_PLAYERS)
+    {
+        int count = gather_moves(&bits, p, first_turn[p], used[p]);
+        if (count == 0)
+        {
+            passes++;
+            continue;
+        }
+        passes = 0;
+
+        const Move* move = &global_moves[rand()%count];
+        board_bits_blit(&bits, p, move->mask, move->col, move->row);
+        used[p][move->piece] = true;
+        first_turn[p] = false;
+        check_frontiers(&bits, game, ++placements);
+    }
+    return placements;
+}
+
+
+/*==============================
+    main
+    Runs the test
+    @return 0 if every frontier matched
+==============================*/
+
+int main()
+{
+    int placements = 0;
+    for (int game=0; game<GAMECOUNT; game++)
+        placements += play_game(game);
+
+    if (global_failures)
+    {
+        printf("%d landgrab frontier checks failed\n", global_failures);
+        return 1;
+    }
+    printf("All landgrab frontier checks passed (%d games, %d placements)\n", GAMECOUNT, placements);
+    return 0;
+}
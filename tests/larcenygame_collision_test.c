@@ -0,0 +1,152 @@
+/***************************************************************
+                  larcenygame_collision_test.c
+
+Host test for the larcenygame collision grid. Checks that the
+grid finds the same collision object as testing all of them in
+order, for the level's boxes and for random layouts.
+Run with "make -C tests".
+***************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "../code/larcenygame/larcenygameCollision.h"
+
+
+/*********************************
+             Globals
+*********************************/
+
+static int global_failures;
+
+
+/*==============================
+    bounds_from_box
+    Makes bounds the same way larcenygame.c does, with
+    the integer sizes halved before they are applied
+    @param  The centre X
+    @param  The centre Z
+    @param  The size along X
+    @param  The size along Z
+    @return The bounds
+==============================*/
+
+static collisionbounds_data bounds_from_box(float x, float z, int sizeX, int sizeZ)
+{
+    return (collisionbounds_data){x - (sizeX / 2), x + (sizeX / 2), z - (sizeZ / 2), z + (sizeZ / 2)};
+}
+
+
+/*==============================
+    find_bruteforce
+    The check from before the grid, testing every
+    object in index order
+    @param  The bounds of every object
+    @param  The number of objects
+    @param  The X position
+    @param  The Z position
+    @return The first object hit, or -1
+==============================*/
+
+static int find_bruteforce(const collisionbounds_data* bounds, int count, float x, float z)
+{
+    for (int i=0; i<count; i++)
+        if (x > bounds[i].minX && x < bounds[i].maxX && z > bounds[i].minZ && z < bounds[i].maxZ)
+            return i;
+    return -1;
+}
+
+
+/*==============================
+    compare_layout
+    Check the grid against the full scan over a sweep
+    of positions, including the exact box edges
+    @param  The name of the layout
+    @param  The bounds of every object
+    @param  The number of objects
+==============================*/
+
+static void compare_layout(const char* name, const collisionbounds_data* bounds, int count)
+{
+    static collisiongrid_data grid;
+    int mismatches = 0;
+
+    collision_grid_build(&grid, bounds, count);
+
+    // A fine sweep, past the grid on every side
+    for (float x=grid.minX-20; x<=grid.maxX+20; x+=0.5f)
+        for (float z=grid.minZ-20; z<=grid.maxZ+20; z+=0.5f)
+            mismatches += collision_grid_find(&grid, x, z) != find_bruteforce(bounds, count, x, z);
+
+    // Every box edge and corner, where the strict comparisons matter
+    for (int i=0; i<count; i++)
+    {
+        float xs[] = {bounds[i].minX, bounds[i].maxX, (bounds[i].minX + bounds[i].maxX) / 2};
+        float zs[] = {bounds[i].minZ, bounds[i].maxZ, (bounds[i].minZ + bounds[i].maxZ) / 2};
+        for (int a=0; a<3; a++)
+            for (int b=0; b<3; b++)
+                for (int dx=-1; dx<=1; dx++)
+                    for (int dz=-1; dz<=1; dz++)
+                    {
+                        float x = xs[a] + dx * 0.001f;
+                        float z = zs[b] + dz * 0.001f;
+                        mismatches += collision_grid_find(&grid, x, z) != find_bruteforce(bounds, count, x, z);
+                    }
+    }
+
+    if (mismatches > 0)
+    {
+        printf("FAIL: %s: %d positions differ from the full scan\n", name, mismatches);
+        global_failures++;
+    }
+}
+
+
+int main()
+{
+    // The level's boxes, as set up in collision_init
+    collisionbounds_data level[MAX_COLLISION_OBJECTS] = {
+        bounds_from_box(0.0f, 0.0f, 120, 40),
+        bounds_from_box(-75.0f, 106.0f, 80, 22),
+        bounds_from_box(-106.0f, -75.0f, 22, 75),
+        bounds_from_box(-75.0f, -106.0f, 80, 22),
+        bounds_from_box(106.0f, -75.0f, 22, 75),
+        bounds_from_box(75.0f, -106.0f, 80, 22),
+        bounds_from_box(106.0f, 75.0f, 22, 75),
+        bounds_from_box(75.0f, 106.0f, 80, 22),
+        bounds_from_box(-106.0f, 75.0f, 22, 75),
+    };
+    compare_layout("level", level, MAX_COLLISION_OBJECTS);
+
+    // Random overlapping layouts, so the index order of hits is checked too
+    srand(1);
+    for (int layout=0; layout<200; layout++)
+    {
+        collisionbounds_data bounds[MAX_COLLISION_OBJECTS];
+        int count = 1 + rand() % MAX_COLLISION_OBJECTS;
+        for (int i=0; i<count; i++)
+            bounds[i] = bounds_from_box(rand() % 241 - 120, rand() % 241 - 120, 1 + rand() % 120, 1 + rand() % 120);
+
+        char name[32];
+        snprintf(name, sizeof(name), "random layout %d", layout);
+        compare_layout(name, bounds, count);
+    }
+
+    // NaN positions never collide
+    {
+        static collisiongrid_data grid;
+        collision_grid_build(&grid, level, MAX_COLLISION_OBJECTS);
+        if (collision_grid_find(&grid, 0.0f/0.0f, 0.0f) != -1)
+        {
+            printf("FAIL: a NaN position collided\n");
+            global_failures++;
+        }
+    }
+
+    if (global_failures > 0)
+    {
+        printf("%d checks failed\n", global_failures);
+        return 1;
+    }
+    printf("All larcenygame collision grid checks passed\n");
+    return 0;
+}
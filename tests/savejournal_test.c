@@ -0,0 +1,219 @@
+/***************************************************************
+                       savejournal_test.c
+
+Host test for savejournal.c. Cuts the power after every block
+write of a save and checks that the newest complete save is
+still the one loaded. Run with "make -C tests".
+***************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <setjmp.h>
+#include "../savejournal.h"
+
+#define SLOTSIZE    32
+#define DATASIZE    (SLOTSIZE-4)
+#define EEPROMSIZE  512
+
+
+/*********************************
+             Globals
+*********************************/
+
+static uint8_t global_eeprom[EEPROMSIZE];
+static int global_writesleft;
+static int global_writecount;
+static jmp_buf global_poweroff;
+static int global_failures;
+
+
+/*==============================
+    eeprom_writeblock
+    Simulated EEPROM block write, which loses power once
+    global_writesleft runs out
+    @param  The block to write
+    @param  The 8 bytes to write
+==============================*/
+
+static void eeprom_writeblock(int block, const uint8_t* data)
+{
+    if (global_writesleft-- == 0)
+        longjmp(global_poweroff, 1);
+    memcpy(&global_eeprom[block*SAVEJOURNAL_BLOCKSIZE], data, SAVEJOURNAL_BLOCKSIZE);
+    global_writecount++;
+}
+
+
+/*==============================
+    boot
+    Read the slots from the simulated EEPROM, like the
+    game does when it starts
+    @param  The journal to set up
+    @param  The buffer for both slots
+    @param  The save to load into
+    @return Whether a valid slot was found
+==============================*/
+
+static bool boot(SaveJournal* journal, uint8_t* slots, uint8_t* save)
+{
+    memcpy(slots, global_eeprom, SLOTSIZE*SAVEJOURNAL_SLOTCOUNT);
+    journal->slots = slots;
+    journal->slotsize = SLOTSIZE;
+    journal->write = eeprom_writeblock;
+
+    int slot = savejournal_load(journal);
+    if (slot == -1)
+    {
+        memset(save, 0, SLOTSIZE);
+        return false;
+    }
+    memcpy(save, &slots[slot*SLOTSIZE], SLOTSIZE);
+    return true;
+}
+
+
+/*==============================
+    check
+    Record a failure if a condition doesn't hold
+    @param  The condition
+    @param  What is being checked
+    @param  How many saves came before
+    @param  After how many block writes power was lost
+==============================*/
+
+static void check(bool condition, const char* what, int saves, int cutoff)
+{
+    if (condition)
+        return;
+    printf("FAIL: %s (after %d saves, cut after %d writes)\n", what, saves, cutoff);
+    global_failures++;
+}
+
+
+/*==============================
+    test_poweroff
+    Cut the power after every possible block write of a
+    save, and check what's loaded afterwards
+==============================*/
+
+static void test_poweroff()
+{
+    for (int saves=0; saves<8; saves++)
+    {
+        for (int cutoff=0; cutoff<=SLOTSIZE/SAVEJOURNAL_BLOCKSIZE; cutoff++)
+        {
+            SaveJournal journal;
+            uint8_t slots[SLOTSIZE*SAVEJOURNAL_SLOTCOUNT];
+            uint8_t save[SLOTSIZE];
+            uint8_t before[DATASIZE];
+            uint8_t after[DATASIZE];
+
+            memset(global_eeprom, 0xFF, sizeof(global_eeprom));
+            global_writesleft = -1;
+            boot(&journal, slots, save);
+            for (int i=0; i<saves; i++)
+            {
+                save[i % DATASIZE] = i+1;
+                savejournal_write(&journal, save);
+            }
+            memcpy(before, save, DATASIZE);
+
+            // Change a byte in every block, so the save writes all of them
+            for (int i=0; i<DATASIZE; i+=SAVEJOURNAL_BLOCKSIZE)
+                save[i] ^= 0x5A;
+            memcpy(after, save, DATASIZE);
+
+            bool finished = false;
+            global_writesleft = cutoff;
+            if (setjmp(global_poweroff) == 0)
+            {
+                savejournal_write(&journal, save);
+                finished = true;
+            }
+
+            global_writesleft = -1;
+            bool found = boot(&journal, slots, save);
+            if (finished)
+                check(found && memcmp(save, after, DATASIZE) == 0, "finished save not loaded", saves, cutoff);
+            else if (saves == 0)
+                check(!found, "torn first save loaded", saves, cutoff);
+            else
+                check(found && memcmp(save, before, DATASIZE) == 0, "previous save not loaded", saves, cutoff);
+
+            // The journal must keep working after a lost write
+            save[0] ^= 0x11;
+            memcpy(after, save, DATASIZE);
+            savejournal_write(&journal, save);
+            found = boot(&journal, slots, save);
+            check(found && memcmp(save, after, DATASIZE) == 0, "save after recovery not loaded", saves, cutoff);
+        }
+    }
+}
+
+
+/*==============================
+    test_delta
+    Check that only changed blocks are written
+==============================*/
+
+static void test_delta()
+{
+    SaveJournal journal;
+    uint8_t slots[SLOTSIZE*SAVEJOURNAL_SLOTCOUNT];
+    uint8_t save[SLOTSIZE];
+
+    memset(global_eeprom, 0xFF, sizeof(global_eeprom));
+    global_writesleft = -1;
+    boot(&journal, slots, save);
+
+    // Fill both slots
+    savejournal_write(&journal, save);
+    savejournal_write(&journal, save);
+
+    global_writecount = 0;
+    for (int i=0; i<100; i++)
+        savejournal_write(&journal, save);
+    check(global_writecount == 100, "unchanged saves wrote more than the last block", 100, -1);
+}
+
+
+/*==============================
+    test_wraparound
+    Check that the newest slot is still picked when the
+    sequence wraps around
+==============================*/
+
+static void test_wraparound()
+{
+    SaveJournal journal;
+    uint8_t slots[SLOTSIZE*SAVEJOURNAL_SLOTCOUNT];
+    uint8_t save[SLOTSIZE];
+
+    memset(global_eeprom, 0xFF, sizeof(global_eeprom));
+    global_writesleft = -1;
+    boot(&journal, slots, save);
+    save[SLOTSIZE-4] = 0xFE;
+    save[SLOTSIZE-3] = 0xFF;
+    for (int i=0; i<4; i++)
+    {
+        save[0] = i;
+        savejournal_write(&journal, save);
+        boot(&journal, slots, save);
+        check(save[0] == i, "newest save not picked across the sequence wrap", i+1, -1);
+    }
+}
+
+
+int main()
+{
+    test_poweroff();
+    test_delta();
+    test_wraparound();
+    if (global_failures > 0)
+    {
+        printf("%d checks failed\n", global_failures);
+        return 1;
+    }
+    printf("All save journal checks passed\n");
+    return 0;
+}
@@ -0,0 +1,29 @@
+/***************************************************************
+                          libdragon.h
+
+Host stand-in for the parts of libdragon that the tested game
+code uses. Functions with side effects are only declared, each
+test defines them to record the calls it checks.
+***************************************************************/
+
+#ifndef TESTS_STUBS_LIBDRAGON_H
+#define TESTS_STUBS_LIBDRAGON_H
+
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct rspq_block_s rspq_block_t;
+typedef struct sprite_s sprite_t;
+typedef struct wav64_s wav64_t;
+typedef struct xm64player_s xm64player_t;
+
+void wav64_play(wav64_t *wav, int ch);
+void xm64player_play(xm64player_t *player, int first_ch);
+
+static inline float fm_atan2f(float y, float x) { return atan2f(y, x); }
+
+#endif
@@ -0,0 +1,64 @@
+/***************************************************************
+                            t3d.h
+
+Host stand-in for the parts of tiny3d that the tested game code
+uses, the other t3d headers only include this one. Functions
+with side effects are only declared, each test defines them to
+record the calls it checks.
+***************************************************************/
+
+#ifndef TESTS_STUBS_T3D_H
+#define TESTS_STUBS_T3D_H
+
+#include <libdragon.h>
+
+#define T3D_PI 3.14159265358979f
+#define T3D_DEG_TO_RAD(deg) ((deg) * (T3D_PI / 180.0f))
+
+typedef struct { float v[3]; } T3DVec3;
+typedef struct T3DMat4FP_s T3DMat4FP;
+typedef struct T3DModel_s T3DModel;
+typedef struct T3DModelDrawConf_s T3DModelDrawConf;
+typedef struct TPXParticle_s TPXParticle;
+
+typedef struct {
+  int bufferCount;
+} T3DSkeleton;
+
+typedef struct {
+  float duration;
+} T3DChunkAnim;
+
+typedef struct {
+  const T3DChunkAnim *animRef;
+  const T3DSkeleton *skeleton;
+  bool isPlaying;
+  float time;
+} T3DAnim;
+
+typedef struct {
+  T3DVec3 camPos;
+  T3DVec3 camTarget;
+} T3DViewport;
+
+void t3d_anim_attach(T3DAnim *anim, const T3DSkeleton *skeleton);
+void t3d_anim_set_playing(T3DAnim *anim, bool playing);
+void t3d_anim_update(T3DAnim *anim, float delta_time);
+void t3d_viewport_look_at(T3DViewport *viewport, const T3DVec3 *eye,
+    const T3DVec3 *target, const T3DVec3 *up);
+
+static inline void t3d_vec3_diff(T3DVec3 *res, const T3DVec3 *a,
+    const T3DVec3 *b) {
+  for (int i = 0; i < 3; i++) {
+    res->v[i] = a->v[i] - b->v[i];
+  }
+}
+
+static inline void t3d_vec3_add(T3DVec3 *res, const T3DVec3 *a,
+    const T3DVec3 *b) {
+  for (int i = 0; i < 3; i++) {
+    res->v[i] = a->v[i] + b->v[i];
+  }
+}
+
+#endif
@@ -0,0 +1,2 @@
+// Host stand-in, everything the tests need is in t3d.h
+#include "t3d.h"